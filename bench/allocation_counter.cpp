@@ -0,0 +1,185 @@
+#include "allocation_counter.hpp"
+
+#include <curl/curl.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace
+{
+
+/**
+ * @brief Количество выделений памяти в потоке.
+ */
+thread_local uint64_t allocations{0};
+
+/**
+ * @brief Выделение памяти с подсчетом.
+ *
+ * @param size Размер в байтах
+ *
+ * @return Указатель на память или nullptr при ошибке выделения
+ */
+void *Allocate(size_t size) noexcept
+{
+    ++allocations;
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+/**
+ * @brief Выделение памяти библиотекой CURL с подсчетом.
+ *
+ * @param size Размер в байтах
+ *
+ * @return Указатель на память
+ */
+void *CurlMalloc(size_t size)
+{
+    return Allocate(size);
+}
+
+/**
+ * @brief Изменение размера памяти библиотекой CURL с подсчетом.
+ *
+ * @param ptr Указатель на память
+ * @param size Новый размер в байтах
+ *
+ * @return Указатель на память
+ */
+void *CurlRealloc(void *ptr, size_t size)
+{
+    ++allocations;
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    return std::realloc(ptr, size);
+}
+
+/**
+ * @brief Выделение обнуленной памяти библиотекой CURL с подсчетом.
+ *
+ * @param count Количество элементов
+ * @param size Размер элемента в байтах
+ *
+ * @return Указатель на память
+ */
+void *CurlCalloc(size_t count, size_t size)
+{
+    ++allocations;
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    return std::calloc(count, size);
+}
+
+/**
+ * @brief Копирование строки библиотекой CURL с подсчетом.
+ *
+ * @param str Строка
+ *
+ * @return Копия строки
+ */
+char *CurlStrdup(const char *str)
+{
+    const size_t size = std::strlen(str) + 1;
+    auto *copy = static_cast<char *>(Allocate(size));
+    if (copy != nullptr)
+    {
+        std::memcpy(copy, str, size);
+    }
+    return copy;
+}
+
+/**
+ * @brief Освобождение памяти библиотекой CURL.
+ *
+ * @param ptr Указатель на память
+ */
+void CurlFree(void *ptr)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    std::free(ptr);
+}
+
+/**
+ * @brief Подключение подсчета выделений памяти библиотеки CURL до первого
+ * обращения к ней.
+ */
+[[maybe_unused]] const CURLcode curl_init = curl_global_init_mem(
+    CURL_GLOBAL_ALL, CurlMalloc, CurlFree, CurlRealloc, CurlStrdup, CurlCalloc);
+
+}  // namespace
+
+// Замена глобальных функций выделения памяти, выровненные варианты не
+// используются библиотекой.
+void *operator new(size_t size)
+{
+    void *ptr = Allocate(size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t & /*tag*/) noexcept
+{
+    return Allocate(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t & /*tag*/) noexcept
+{
+    return Allocate(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete(void *ptr, size_t /*size*/) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete[](void *ptr, size_t /*size*/) noexcept
+{
+    operator delete(ptr);
+}
+
+namespace tasp::bench
+{
+
+/*------------------------------------------------------------------------------
+    AllocationScope
+------------------------------------------------------------------------------*/
+uint64_t Allocations() noexcept
+{
+    return allocations;
+}
+
+//------------------------------------------------------------------------------
+AllocationScope::AllocationScope(benchmark::State &state) noexcept
+: state_(state)
+, start_(Allocations())
+{
+}
+
+//------------------------------------------------------------------------------
+AllocationScope::~AllocationScope() noexcept
+{
+    state_.counters["allocs"] =
+        benchmark::Counter(static_cast<double>(Allocations() - start_),
+                           benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace tasp::bench
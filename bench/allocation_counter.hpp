@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @brief Подсчет выделений памяти для измерений производительности.
+ */
+#ifndef TASP_BENCH_ALLOCATION_COUNTER_HPP_
+#define TASP_BENCH_ALLOCATION_COUNTER_HPP_
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+namespace tasp::bench
+{
+
+/**
+ * @brief Запрос количества выделений памяти в текущем потоке.
+ *
+ * Выделения подсчитываются замененным глобальным operator new и функциями
+ * выделения памяти библиотеки CURL (curl_global_init_mem). Учитываются
+ * только выделения потока измерения, выделения потока тестового сервера не
+ * учитываются.
+ *
+ * @return Количество выделений с начала работы потока
+ */
+[[nodiscard]] uint64_t Allocations() noexcept;
+
+/**
+ * @brief Подсчет выделений памяти за время измерения.
+ *
+ * Объект создается перед циклом измерения, при удалении добавляет счетчик
+ * allocs - среднее количество выделений памяти на итерацию.
+ */
+class AllocationScope final
+{
+public:
+    /**
+     * @brief Конструктор.
+     *
+     * @param state Состояние измерения
+     */
+    explicit AllocationScope(benchmark::State &state) noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~AllocationScope() noexcept;
+
+    AllocationScope(const AllocationScope &) = delete;
+    AllocationScope(AllocationScope &&) = delete;
+    AllocationScope &operator=(const AllocationScope &) = delete;
+    AllocationScope &operator=(AllocationScope &&) = delete;
+
+private:
+    /**
+     * @brief Состояние измерения.
+     */
+    benchmark::State &state_;
+
+    /**
+     * @brief Количество выделений памяти до начала измерения.
+     */
+    uint64_t start_;
+};
+
+}  // namespace tasp::bench
+
+#endif  // TASP_BENCH_ALLOCATION_COUNTER_HPP_
@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @brief Измерение создания клиента и выполнения запросов к тестовому
+ * серверу на локальном интерфейсе.
+ */
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <tasp/http/client.hpp>
+
+#include "allocation_counter.hpp"
+#include "loopback_server.hpp"
+
+using tasp::bench::AllocationScope;
+using tasp::bench::LoopbackServer;
+using tasp::http::Client;
+using tasp::http::Request;
+
+namespace
+{
+
+/**
+ * @brief Создание и удаление клиента.
+ *
+ * @param state Состояние измерения
+ */
+void ClientConstruct(benchmark::State &state)
+{
+    const AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        const Client client("127.0.0.1", 8080, "/api/v1/items");
+        benchmark::DoNotOptimize(&client);
+    }
+}
+
+/**
+ * @brief Выполнение запросов одним клиентом через постоянное соединение.
+ *
+ * Аргумент измерения - размер данных ответа в байтах.
+ *
+ * @param state Состояние измерения
+ */
+void ClientSend(benchmark::State &state)
+{
+    const LoopbackServer server(
+        std::string(static_cast<size_t>(state.range(0)), 'x'));
+    if (server.Port() == 0)
+    {
+        state.SkipWithError("Ошибка запуска тестового сервера");
+        return;
+    }
+
+    const Client client("127.0.0.1", server.Port(), "/api/v1/items");
+
+    const AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        const auto response = client.Send();
+        if (static_cast<int>(response->GetCode()) != 200)
+        {
+            state.SkipWithError("Ошибка выполнения запроса");
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief Выполнение запросов с данными запроса и изменением пути, как при
+ * повторном использовании клиента.
+ *
+ * @param state Состояние измерения
+ */
+void ClientResetSend(benchmark::State &state)
+{
+    const LoopbackServer server;
+    if (server.Port() == 0)
+    {
+        state.SkipWithError("Ошибка запуска тестового сервера");
+        return;
+    }
+
+    Client client("127.0.0.1", server.Port(), "/");
+    const std::string body(static_cast<size_t>(state.range(0)), 'x');
+
+    const AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        client.Reset("/api/v1/items", Request::Method::Post);
+        client.Request()->Data()->Set(body);
+
+        const auto response = client.Send();
+        if (static_cast<int>(response->GetCode()) != 200)
+        {
+            state.SkipWithError("Ошибка выполнения запроса");
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(ClientConstruct);
+BENCHMARK(ClientSend)->Arg(16)->Arg(16384)->UseRealTime();
+BENCHMARK(ClientResetSend)->Arg(0)->Arg(4096)->UseRealTime();
@@ -0,0 +1,116 @@
+/**
+ * @file
+ * @brief Измерение формирования заголовка запроса и разбора заголовка ответа.
+ */
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <memory>
+#include <string_view>
+
+#include "allocation_counter.hpp"
+#include "http/header_impl.hpp"
+
+using std::shared_ptr;
+using std::string_view;
+using tasp::bench::AllocationScope;
+using tasp::http::Header;
+using tasp::http::HeaderImpl;
+
+namespace
+{
+
+/**
+ * @brief Строки типичного заголовка ответа в том виде, в котором их
+ * передает библиотека CURL.
+ */
+constexpr std::array<string_view, 8> response_lines{
+    "HTTP/1.1 200 OK\r\n",
+    "Date: Fri, 16 Oct 2026 12:00:00 GMT\r\n",
+    "Content-Type: application/json; charset=UTF-8\r\n",
+    "Content-Length: 1024\r\n",
+    "Connection: keep-alive\r\n",
+    "Set-Cookie: session=abc; Path=/\r\n",
+    "Set-Cookie: theme=dark; Path=/\r\n",
+    "\r\n"};
+
+/**
+ * @brief Формирование указателя на главную структуру библиотеки CURL.
+ *
+ * @return Указатель
+ */
+shared_ptr<CURL> MakeCurl() noexcept
+{
+    return {curl_easy_init(), curl_easy_cleanup};
+}
+
+/**
+ * @brief Установка параметров заголовка запроса и передача в библиотеку CURL
+ * при каждом изменении.
+ *
+ * @param state Состояние измерения
+ */
+void HeaderSet(benchmark::State &state)
+{
+    HeaderImpl header(MakeCurl(), Header::Type::Output);
+    header.Set("Content-Type", "application/json; charset=UTF-8");
+
+    const AllocationScope allocations(state);
+    size_t counter{0};
+    for (auto _ : state)
+    {
+        header.Set("X-Request-Id", (++counter % 2) != 0 ? "odd" : "even");
+        header.Apply();
+    }
+}
+
+/**
+ * @brief Повторная установка неизменного значения без формирования списка
+ * заголовков библиотеки CURL.
+ *
+ * @param state Состояние измерения
+ */
+void HeaderSetUnchanged(benchmark::State &state)
+{
+    HeaderImpl header(MakeCurl(), Header::Type::Output);
+    header.Set("Content-Type", "application/json; charset=UTF-8");
+
+    const AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        header.Set("Content-Type", "application/json; charset=UTF-8");
+        header.Apply();
+    }
+}
+
+/**
+ * @brief Разбор заголовка ответа и поиск параметров.
+ *
+ * @param state Состояние измерения
+ */
+void HeaderParse(benchmark::State &state)
+{
+    HeaderImpl header(nullptr);
+
+    const AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        for (const auto line : response_lines)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            HeaderImpl::Callback(const_cast<char *>(line.data()),
+                                 1,
+                                 line.size(),
+                                 &header);
+        }
+
+        benchmark::DoNotOptimize(header.Value("content-length"));
+        benchmark::DoNotOptimize(header.Values("Set-Cookie"));
+    }
+}
+
+}  // namespace
+
+BENCHMARK(HeaderSet);
+BENCHMARK(HeaderSetUnchanged);
+BENCHMARK(HeaderParse);
@@ -0,0 +1,274 @@
+#include "loopback_server.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <string_view>
+
+using std::string;
+using std::string_view;
+
+namespace tasp::bench
+{
+
+namespace
+{
+
+/**
+ * @brief Запрос значения заголовка запроса.
+ *
+ * @param head Строка запроса и заголовок без завершающей пустой строки
+ * @param name Имя заголовка в нижнем регистре с двоеточием
+ *
+ * @return Значение заголовка без начальных пробелов, пустое - заголовок
+ * отсутствует
+ */
+string_view HeaderValue(string_view head, string_view name) noexcept
+{
+    for (size_t begin = head.find("\r\n"); begin != string_view::npos;
+         begin = head.find("\r\n", begin + 2))
+    {
+        string_view line = head.substr(begin + 2);
+        line = line.substr(0, line.find("\r\n"));
+
+        if (line.size() >= name.size() &&
+            strncasecmp(line.data(), name.data(), name.size()) == 0)
+        {
+            line.remove_prefix(name.size());
+            line.remove_prefix(std::min(line.find_first_not_of(' '),
+                                        line.size()));
+            return line;
+        }
+    }
+
+    return {};
+}
+
+/**
+ * @brief Запрос размера данных запроса из заголовка Content-Length.
+ *
+ * @param head Строка запроса и заголовок без завершающей пустой строки
+ *
+ * @return Размер данных в байтах, 0 - заголовок отсутствует
+ */
+size_t ContentLength(string_view head) noexcept
+{
+    const string_view value = HeaderValue(head, "content-length:");
+
+    return value.empty() ? 0 : std::strtoul(value.data(), nullptr, 10);
+}
+
+/**
+ * @brief Проверка ожидания клиентом подтверждения перед отправкой данных
+ * запроса (Expect: 100-continue).
+ *
+ * @param head Строка запроса и заголовок без завершающей пустой строки
+ *
+ * @return Признак ожидания подтверждения
+ */
+bool ExpectContinue(string_view head) noexcept
+{
+    static constexpr string_view expected{"100-continue"};
+
+    const string_view value = HeaderValue(head, "expect:");
+
+    return value.size() >= expected.size() &&
+           strncasecmp(value.data(), expected.data(), expected.size()) == 0;
+}
+
+/**
+ * @brief Отправка данных в соединение целиком.
+ *
+ * @param fd Дескриптор соединения
+ * @param data Данные
+ *
+ * @return Признак успешной отправки
+ */
+bool SendAll(int fd, string_view data) noexcept
+{
+    while (!data.empty())
+    {
+        const ssize_t sent = send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+        if (sent <= 0)
+        {
+            return false;
+        }
+        data.remove_prefix(static_cast<size_t>(sent));
+    }
+
+    return true;
+}
+
+}  // namespace
+
+/*------------------------------------------------------------------------------
+    LoopbackServer
+------------------------------------------------------------------------------*/
+LoopbackServer::LoopbackServer(string body) noexcept
+{
+    response_.append("HTTP/1.1 200 OK\r\n")
+        .append("Content-Type: application/json\r\n")
+        .append("Content-Length: ")
+        .append(std::to_string(body.size()))
+        .append("\r\n\r\n")
+        .append(body);
+
+    listen_fd_ = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0)
+    {
+        return;
+    }
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto *socket_address = reinterpret_cast<sockaddr *>(&address);
+    socklen_t length = sizeof(address);
+
+    if (bind(listen_fd_, socket_address, length) != 0 ||
+        listen(listen_fd_, SOMAXCONN) != 0 ||
+        getsockname(listen_fd_, socket_address, &length) != 0)
+    {
+        close(listen_fd_);
+        listen_fd_ = -1;
+        return;
+    }
+
+    port_ = ntohs(address.sin_port);
+    thread_ = std::thread(&LoopbackServer::Accept, this);
+}
+
+//------------------------------------------------------------------------------
+LoopbackServer::~LoopbackServer() noexcept
+{
+    stopped_ = true;
+
+    if (listen_fd_ >= 0)
+    {
+        shutdown(listen_fd_, SHUT_RDWR);
+    }
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+    if (listen_fd_ >= 0)
+    {
+        close(listen_fd_);
+    }
+
+    {
+        const std::lock_guard lock(mutex_);
+        for (const int fd : connections_)
+        {
+            shutdown(fd, SHUT_RDWR);
+        }
+    }
+
+    for (auto &worker : workers_)
+    {
+        worker.join();
+    }
+
+    for (const int fd : connections_)
+    {
+        close(fd);
+    }
+}
+
+//------------------------------------------------------------------------------
+int LoopbackServer::Port() const noexcept
+{
+    return port_;
+}
+
+//------------------------------------------------------------------------------
+void LoopbackServer::Accept() noexcept
+{
+    while (!stopped_)
+    {
+        const int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            continue;
+        }
+
+        const int flag{1};
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+
+        const std::lock_guard lock(mutex_);
+        if (stopped_)
+        {
+            close(fd);
+            break;
+        }
+
+        connections_.push_back(fd);
+        workers_.emplace_back(&LoopbackServer::Serve, this, fd);
+    }
+}
+
+//------------------------------------------------------------------------------
+void LoopbackServer::Serve(int fd) const noexcept
+{
+    static constexpr size_t chunk_size{16384};
+
+    string buffer;
+    string chunk(chunk_size, '\0');
+
+    // Подтверждение отправлено для текущего запроса.
+    bool continued{false};
+
+    while (true)
+    {
+        const ssize_t received = recv(fd, chunk.data(), chunk.size(), 0);
+        if (received <= 0)
+        {
+            return;
+        }
+        buffer.append(chunk.data(), static_cast<size_t>(received));
+
+        // Обработка всех полностью принятых запросов.
+        while (true)
+        {
+            const size_t head_end = buffer.find("\r\n\r\n");
+            if (head_end == string::npos)
+            {
+                break;
+            }
+
+            const string_view head = string_view(buffer).substr(0, head_end);
+            const size_t length = head_end + 4 + ContentLength(head);
+            if (buffer.size() < length)
+            {
+                // Клиент ожидает подтверждения перед отправкой данных.
+                if (!continued && ExpectContinue(head))
+                {
+                    if (!SendAll(fd, "HTTP/1.1 100 Continue\r\n\r\n"))
+                    {
+                        return;
+                    }
+                    continued = true;
+                }
+                break;
+            }
+            buffer.erase(0, length);
+            continued = false;
+
+            if (!SendAll(fd, response_))
+            {
+                return;
+            }
+        }
+    }
+}
+
+}  // namespace tasp::bench
@@ -0,0 +1,110 @@
+/**
+ * @file
+ * @brief Тестовый HTTP-сервер на локальном интерфейсе для измерений.
+ */
+#ifndef TASP_BENCH_LOOPBACK_SERVER_HPP_
+#define TASP_BENCH_LOOPBACK_SERVER_HPP_
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tasp::bench
+{
+
+/**
+ * @brief Минимальный HTTP/1.1-сервер в потоках процесса, отвечающий на все
+ * запросы кодом 200 с заданными данными.
+ *
+ * Сервер принимает соединения на адресе 127.0.0.1 со случайным портом,
+ * поддерживает постоянные соединения (keep-alive), отвечает на
+ * Expect: 100-continue и пропускает данные запроса по заголовку
+ * Content-Length. Сеть, кроме локального интерфейса,
+ * не используется.
+ */
+class LoopbackServer final
+{
+public:
+    /**
+     * @brief Конструктор с запуском сервера.
+     *
+     * @param body Данные ответа
+     */
+    explicit LoopbackServer(std::string body = "{}") noexcept;
+
+    /**
+     * @brief Деструктор с остановкой сервера.
+     */
+    ~LoopbackServer() noexcept;
+
+    /**
+     * @brief Запрос порта сервера.
+     *
+     * @return Порт или 0, если сервер не запущен
+     */
+    [[nodiscard]] int Port() const noexcept;
+
+    LoopbackServer(const LoopbackServer &) = delete;
+    LoopbackServer(LoopbackServer &&) = delete;
+    LoopbackServer &operator=(const LoopbackServer &) = delete;
+    LoopbackServer &operator=(LoopbackServer &&) = delete;
+
+private:
+    /**
+     * @brief Функция потока приема соединений.
+     */
+    void Accept() noexcept;
+
+    /**
+     * @brief Функция потока обработки соединения.
+     *
+     * @param fd Дескриптор соединения
+     */
+    void Serve(int fd) const noexcept;
+
+    /**
+     * @brief Ответ на каждый запрос.
+     */
+    std::string response_;
+
+    /**
+     * @brief Дескриптор сокета приема соединений.
+     */
+    int listen_fd_{-1};
+
+    /**
+     * @brief Порт сервера.
+     */
+    int port_{0};
+
+    /**
+     * @brief Признак остановки сервера.
+     */
+    std::atomic<bool> stopped_{false};
+
+    /**
+     * @brief Поток приема соединений.
+     */
+    std::thread thread_;
+
+    /**
+     * @brief Блокировка списка соединений.
+     */
+    std::mutex mutex_;
+
+    /**
+     * @brief Дескрипторы открытых соединений.
+     */
+    std::vector<int> connections_;
+
+    /**
+     * @brief Потоки обработки соединений.
+     */
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace tasp::bench
+
+#endif  // TASP_BENCH_LOOPBACK_SERVER_HPP_
@@ -0,0 +1,73 @@
+/**
+ * @file
+ * @brief Измерение изменения пути и разбора параметров URI.
+ */
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <memory>
+#include <string_view>
+
+#include "allocation_counter.hpp"
+#include "http/uri_impl.hpp"
+
+using std::shared_ptr;
+using std::string_view;
+using tasp::bench::AllocationScope;
+using tasp::http::UriImpl;
+
+namespace
+{
+
+/**
+ * @brief Формирование указателя на главную структуру библиотеки CURL.
+ *
+ * @return Указатель
+ */
+shared_ptr<CURL> MakeCurl() noexcept
+{
+    return {curl_easy_init(), curl_easy_cleanup};
+}
+
+/**
+ * @brief Изменение пути запроса с формированием URL.
+ *
+ * @param state Состояние измерения
+ */
+void UriChangePath(benchmark::State &state)
+{
+    static constexpr std::array<string_view, 2> paths{"/api/v1/items",
+                                                      "/api/v1/users/42"};
+
+    UriImpl uri("127.0.0.1", 8080, "/", MakeCurl());
+
+    const AllocationScope allocations(state);
+    size_t counter{0};
+    for (auto _ : state)
+    {
+        uri.ChangePath(paths.at(++counter % paths.size()));
+        benchmark::DoNotOptimize(uri.Url());
+    }
+}
+
+/**
+ * @brief Установка строки параметров и запрос значений параметра.
+ *
+ * @param state Состояние измерения
+ */
+void UriParamValues(benchmark::State &state)
+{
+    UriImpl uri("127.0.0.1", 8080, "/api/v1/items", MakeCurl());
+
+    const AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        uri.SetQuery("id=1,2,3&sort=name&limit=100");
+        benchmark::DoNotOptimize(uri.ParamValues("id"));
+    }
+}
+
+}  // namespace
+
+BENCHMARK(UriChangePath);
+BENCHMARK(UriParamValues);
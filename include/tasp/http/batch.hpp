@@ -0,0 +1,94 @@
+/**
+ * @file
+ * @brief Интерфейс для параллельного выполнения группы HTTP-запросов.
+ */
+#ifndef TASP_HTTP_BATCH_HPP_
+#define TASP_HTTP_BATCH_HPP_
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <tasp/http/client.hpp>
+
+namespace tasp::http
+{
+
+class BatchImpl;
+
+/**
+ * @brief Интерфейс для параллельного выполнения группы HTTP-запросов.
+ *
+ * Запросы выполняются одновременно в вызывающем потоке, поэтому общее время
+ * выполнения определяется самым долгим запросом.
+ *
+ * Класс скрывает от пользователя реализацию с помощью идиомы PIMPL
+ * (Pointer to Implementation – указатель на реализацию).
+ */
+class [[gnu::visibility("default")]] Batch final
+{
+public:
+    /**
+     * @brief Результат выполнения запроса группы.
+     */
+    struct Result
+    {
+        /**
+         * @brief Ответ на запрос.
+         */
+        std::shared_ptr<http::Response> response;
+
+        /**
+         * @brief Признак успешной передачи запроса и получения ответа.
+         */
+        bool completed{false};
+
+        /**
+         * @brief Время выполнения запроса, подробные временные
+         * характеристики доступны через GetTiming.
+         */
+        std::chrono::microseconds duration{0};
+    };
+
+    /**
+     * @brief Конструктор.
+     */
+    Batch() noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~Batch() noexcept;
+
+    /**
+     * @brief Добавление запроса в группу.
+     *
+     * Клиент должен существовать до завершения выполнения группы. Один клиент
+     * не может быть добавлен в группу дважды.
+     *
+     * @param client Клиент с настроенным запросом
+     */
+    void Add(const Client &client) noexcept;
+
+    /**
+     * @brief Выполнение запросов группы.
+     *
+     * @return Результаты в порядке добавления запросов
+     */
+    [[nodiscard]] std::vector<Result> Send() const noexcept;
+
+    Batch(const Batch &) = delete;
+    Batch(Batch &&) = delete;
+    Batch &operator=(const Batch &) = delete;
+    Batch &operator=(Batch &&) = delete;
+
+private:
+    /**
+     * @brief Указатель на реализацию.
+     */
+    std::unique_ptr<BatchImpl> impl_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_BATCH_HPP_
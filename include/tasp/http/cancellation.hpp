@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @brief Интерфейс для отмены выполняемых HTTP-запросов.
+ */
+#ifndef TASP_HTTP_CANCELLATION_HPP_
+#define TASP_HTTP_CANCELLATION_HPP_
+
+#include <atomic>
+#include <memory>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Признак отмены запросов.
+ *
+ * Копии признака разделяют общее состояние, поэтому один признак может быть
+ * передан нескольким клиентам и отменен из любого потока. Отмена прерывает
+ * выполняемую передачу данных и повторные попытки, ошибка передачи имеет
+ * категорию Aborted.
+ */
+class [[gnu::visibility("default")]] CancellationToken final
+{
+public:
+    /**
+     * @brief Конструктор.
+     */
+    CancellationToken() noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~CancellationToken() noexcept;
+
+    /**
+     * @brief Конструктор копирования.
+     *
+     * @param other Копируемый признак
+     */
+    CancellationToken(const CancellationToken &other) noexcept;
+
+    /**
+     * @brief Оператор присваивания.
+     *
+     * @param other Копируемый признак
+     *
+     * @return Признак
+     */
+    CancellationToken &operator=(const CancellationToken &other) noexcept;
+
+    /**
+     * @brief Отмена запросов. Функция потокобезопасна.
+     */
+    void Cancel() const noexcept;
+
+    /**
+     * @brief Проверка отмены запросов. Функция потокобезопасна.
+     *
+     * @return Признак отмены
+     */
+    [[nodiscard]] bool IsCancelled() const noexcept;
+
+private:
+    friend class ClientImpl;
+
+    /**
+     * @brief Общее состояние признака.
+     */
+    std::shared_ptr<std::atomic<bool>> state_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_CANCELLATION_HPP_
@@ -5,9 +5,14 @@
 #ifndef TASP_HTTP_CLIENT_HPP_
 #define TASP_HTTP_CLIENT_HPP_
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string_view>
 
+#include <tasp/http/cancellation.hpp>
 #include <tasp/http/request.hpp>
 #include <tasp/http/response.hpp>
 
@@ -25,6 +30,34 @@ class ClientImpl;
 class [[gnu::visibility("default")]] Client final
 {
 public:
+    /**
+     * @brief Функция приема фрагментов данных ответа. Возврат false прерывает
+     * выполнение запроса. Пустые фрагменты функции не передаются.
+     */
+    using Sink = std::function<bool(std::string_view)>;
+
+    /**
+     * @brief Результат попытки выполнения запроса для функции приема данных.
+     */
+    enum class SinkStatus
+    {
+        Complete,  ///< Данные ответа приняты полностью
+        Aborted    ///< Попытка прервана, принятые данные неполные
+    };
+
+    /**
+     * @brief Функция, вызываемая по окончании каждой попытки выполнения
+     * запроса с функцией приема данных. Возврат false при полностью принятых
+     * данных устанавливает ошибку передачи (CURLE_WRITE_ERROR).
+     */
+    using SinkEnd = std::function<bool(SinkStatus)>;
+
+    /**
+     * @brief Функция чтения очередного фрагмента данных запроса. Возвращает
+     * количество записанных в буфер байт или 0 по окончании данных.
+     */
+    using Source = std::function<size_t(char *, size_t)>;
+
     /**
      * @brief Конструктор.
      *
@@ -54,6 +87,34 @@ public:
      */
     ~Client() noexcept;
 
+    /**
+     * @brief Конструктор перемещения.
+     *
+     * @param other Перемещаемый клиент, после перемещения не может
+     * использоваться
+     */
+    Client(Client &&other) noexcept;
+
+    /**
+     * @brief Оператор перемещения.
+     *
+     * @param other Перемещаемый клиент, после перемещения не может
+     * использоваться
+     *
+     * @return Клиент
+     */
+    Client &operator=(Client &&other) noexcept;
+
+    /**
+     * @brief Сброс кэша параметров сервисов.
+     *
+     * Параметры раздела services загружаются из глобального
+     * конфигурационного файла один раз для всех клиентов. Функцию необходимо
+     * вызвать после перезагрузки конфигурационного файла, чтобы новые клиенты
+     * использовали измененные параметры.
+     */
+    static void ReloadServices() noexcept;
+
     /**
      * @brief Получения данных запроса.
      *
@@ -68,12 +129,125 @@ public:
      */
     [[nodiscard]] std::shared_ptr<Response> Send() const noexcept;
 
+    /**
+     * @brief Асинхронное выполнение запроса.
+     *
+     * Запрос выполняется в общем для всех клиентов потоке цикла обработки
+     * событий. До получения результата клиент нельзя использовать для
+     * отправки других запросов, но можно удалить.
+     *
+     * @return Будущий результат выполнения запроса
+     */
+    [[nodiscard]] std::future<std::shared_ptr<Response>> SendAsync()
+        const noexcept;
+
+    /**
+     * @brief Асинхронное выполнение запроса с вызовом функции по завершении.
+     *
+     * Функция вызывается из потока цикла обработки событий и не должна
+     * выполнять длительных операций.
+     *
+     * @param callback Функция, получающая результат выполнения запроса
+     */
+    void SendAsync(
+        std::function<void(std::shared_ptr<Response>)> callback) const noexcept;
+
+    /**
+     * @brief Сброс запроса для повторного использования клиента.
+     *
+     * Меняет метод и путь запроса, удаляет параметры и данные запроса с
+     * сохранением заголовка запроса, функции приема данных ответа и открытых
+     * соединений. Не должен вызываться до завершения асинхронного запроса.
+     *
+     * @param path Путь запроса
+     * @param method Метод запроса
+     */
+    void Reset(std::string_view path,
+               Request::Method method = Request::Method::Get) noexcept;
+
+    /**
+     * @brief Установка строки параметров запроса.
+     *
+     * @param query Строка параметров в закодированном виде без символа ?,
+     * пустая строка удаляет параметры
+     */
+    void SetQuery(std::string_view query) noexcept;
+
+    /**
+     * @brief Установка функции приема данных ответа.
+     *
+     * Данные ответа передаются функции по мере получения без сохранения в
+     * объекте ответа. Функция используется во всех последующих запросах
+     * клиента, пустая функция восстанавливает сохранение данных в ответе.
+     * Функция окончания позволяет обработать остаток данных после полного
+     * приема ответа или сбросить состояние после прерванной попытки.
+     *
+     * @param sink Функция приема фрагментов данных ответа
+     * @param end Функция, вызываемая по окончании каждой попытки
+     */
+    void SetResponseSink(Sink sink, SinkEnd end = {}) noexcept;
+
+    /**
+     * @brief Установка записи данных ответа в файловый дескриптор.
+     *
+     * Дескриптор не закрывается клиентом и должен оставаться открытым до
+     * завершения запросов.
+     *
+     * @param fd Файловый дескриптор, открытый на запись
+     */
+    void SetResponseSink(int fd) noexcept;
+
+    /**
+     * @brief Установка источника данных запроса.
+     *
+     * Данные читаются из функции по мере передачи вместо данных объекта
+     * запроса. Если размер неизвестен, данные передаются по частям
+     * (Transfer-Encoding: chunked). Пустая функция восстанавливает передачу
+     * данных объекта запроса.
+     *
+     * @param source Функция чтения данных
+     * @param length Размер данных в байтах или -1, если размер неизвестен
+     */
+    void SetRequestSource(Source source, int64_t length = -1) noexcept;
+
+    /**
+     * @brief Установка файла в качестве источника данных запроса.
+     *
+     * Файл отображается в память и передается без полной загрузки в память
+     * процесса, при каждом выполнении запроса передача начинается с начала
+     * файла.
+     *
+     * @param path Путь к файлу
+     *
+     * @return Результат открытия файла
+     */
+    bool SetRequestFile(std::string_view path) noexcept;
+
+    /**
+     * @brief Установка крайнего срока выполнения запроса.
+     *
+     * Срок распространяется на все попытки выполнения запроса: время каждой
+     * попытки ограничивается оставшимся временем, повторная попытка не
+     * выполняется, если срок истечет до ее начала. Если для сервиса задан
+     * параметр timeout, используется более ранний срок.
+     *
+     * @param deadline Крайний срок, time_point::max() - без ограничения
+     */
+    void SetDeadline(std::chrono::steady_clock::time_point deadline) noexcept;
+
+    /**
+     * @brief Установка признака отмены запросов клиента.
+     *
+     * @param token Признак отмены
+     */
+    void SetCancellation(const CancellationToken &token) noexcept;
+
     Client(const Client &) = delete;
-    Client(Client &&) = delete;
     Client &operator=(const Client &) = delete;
-    Client &operator=(Client &&) = delete;
 
 private:
+    friend class Batch;
+
     /**
      * @brief Указатель на реализацию.
      */
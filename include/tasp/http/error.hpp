@@ -0,0 +1,76 @@
+/**
+ * @file
+ * @brief Интерфейс для получения ошибки передачи HTTP-запроса.
+ */
+#ifndef TASP_HTTP_ERROR_HPP_
+#define TASP_HTTP_ERROR_HPP_
+
+#include <string>
+
+#include <tasp/http/response.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Ошибка передачи запроса, при которой ответ сервиса не получен.
+ *
+ * При ошибке передачи код ответа не устанавливается (равен 0), поэтому
+ * ошибка передачи не смешивается с ответами сервиса, например 404.
+ */
+struct TransportError
+{
+    /**
+     * @brief Категория ошибки.
+     */
+    enum class Category
+    {
+        None,      ///< Ошибки нет, ответ получен
+        Resolve,   ///< Ошибка разрешения имени хоста
+        Connect,   ///< Ошибка установления соединения
+        Timeout,   ///< Превышено время ожидания
+        Tls,       ///< Ошибка установления TLS-соединения
+        Send,      ///< Ошибка передачи запроса
+        Receive,   ///< Ошибка приема ответа
+        Protocol,  ///< Нарушение протокола HTTP
+        Limit,     ///< Превышен максимальный размер ответа
+        Aborted,   ///< Выполнение прервано функцией приема или источником
+        Other      ///< Прочие ошибки
+    };
+
+    /**
+     * @brief Код ошибки библиотеки CURL (значение CURLcode).
+     */
+    int code{0};
+
+    /**
+     * @brief Категория ошибки.
+     */
+    Category category{Category::None};
+
+    /**
+     * @brief Признак временной ошибки, при которой запрос можно повторить или
+     * отправить на другой узел сервиса.
+     */
+    bool retriable{false};
+
+    /**
+     * @brief Описание ошибки.
+     */
+    std::string message;
+};
+
+/**
+ * @brief Запрос ошибки передачи запроса.
+ *
+ * @param response Ответ, полученный от клиента библиотеки
+ *
+ * @return Ошибка передачи, пустая для полученных ответов и ответов, созданных
+ * вне библиотеки
+ */
+[[nodiscard]] [[gnu::visibility("default")]] TransportError GetError(
+    const Response &response) noexcept;
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_ERROR_HPP_
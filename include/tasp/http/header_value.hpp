@@ -0,0 +1,45 @@
+/**
+ * @file
+ * @brief Интерфейс для получения значений заголовка HTTP без копирования.
+ */
+#ifndef TASP_HTTP_HEADER_VALUE_HPP_
+#define TASP_HTTP_HEADER_VALUE_HPP_
+
+#include <string_view>
+#include <vector>
+
+#include <tasp/http/header.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Запрос первого значения параметра заголовка без копирования.
+ *
+ * Значение ссылается на память заголовка и действительно до его изменения
+ * или удаления.
+ *
+ * @param header Заголовок запроса или ответа
+ * @param name Название параметра без учета регистра для заголовка ответа
+ *
+ * @return Значение или пустая строка, если параметр отсутствует
+ */
+[[nodiscard]] [[gnu::visibility("default")]] std::string_view GetHeaderValue(
+    const Header &header,
+    std::string_view name) noexcept;
+
+/**
+ * @brief Запрос всех значений повторяющегося параметра заголовка (например,
+ * Set-Cookie) без копирования.
+ *
+ * @param header Заголовок запроса или ответа
+ * @param name Название параметра без учета регистра для заголовка ответа
+ *
+ * @return Значения в порядке получения
+ */
+[[nodiscard]] [[gnu::visibility("default")]] std::vector<std::string_view>
+GetHeaderValues(const Header &header, std::string_view name) noexcept;
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_HEADER_VALUE_HPP_
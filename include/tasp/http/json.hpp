@@ -0,0 +1,85 @@
+/**
+ * @file
+ * @brief Интерфейс для разбора данных ответа в формате JSON по мере приема.
+ */
+#ifndef TASP_HTTP_JSON_HPP_
+#define TASP_HTTP_JSON_HPP_
+
+#include <json/value.h>
+
+#include <functional>
+
+#include <tasp/http/client.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Функция обработки разобранного значения JSON. Возврат false
+ * прерывает выполнение запроса.
+ *
+ * Функции приема данных, формируемые ниже, хранят состояние разбора и не
+ * должны использоваться одновременно несколькими клиентами.
+ */
+using JsonHandler = std::function<bool(const Json::Value &)>;
+
+/**
+ * @brief Функции приема данных ответа в формате JSON для
+ * Client::SetResponseSink.
+ *
+ * Пример: auto json = JsonLinesSink(handler);
+ * client.SetResponseSink(json.sink, json.end);
+ */
+struct JsonSink
+{
+    /**
+     * @brief Функция приема фрагментов данных ответа.
+     */
+    Client::Sink sink;
+
+    /**
+     * @brief Функция окончания попытки: разбор оставшихся данных после
+     * полного приема ответа или сброс состояния после прерванной попытки.
+     */
+    Client::SinkEnd end;
+};
+
+/**
+ * @brief Формирование функций приема данных ответа в формате JSON Lines
+ * (NDJSON).
+ *
+ * Каждая строка разбирается сразу после приема, поэтому разбор выполняется
+ * параллельно с передачей, а в памяти хранится только неполная строка.
+ * Пустые строки пропускаются. Ошибка разбора строки прерывает выполнение
+ * запроса.
+ *
+ * @param handler Функция обработки значения каждой строки
+ * @param max_size Максимальный размер строки в байтах, 0 - без ограничения
+ *
+ * @return Функции приема данных ответа
+ */
+[[nodiscard]] [[gnu::visibility("default")]] JsonSink JsonLinesSink(
+    JsonHandler handler,
+    size_t max_size = 0) noexcept;
+
+/**
+ * @brief Формирование функций приема данных ответа, содержащих массив JSON.
+ *
+ * Элементы массива верхнего уровня разбираются по мере приема, в памяти
+ * хранится только неполный элемент. Если данные ответа не являются
+ * массивом, они разбираются целиком по окончании приема и передаются
+ * функции обработки одним значением. Ошибка разбора прерывает выполнение
+ * запроса.
+ *
+ * @param handler Функция обработки каждого элемента массива
+ * @param max_size Максимальный размер элемента в байтах, 0 - без ограничения
+ *
+ * @return Функции приема данных ответа
+ */
+[[nodiscard]] [[gnu::visibility("default")]] JsonSink JsonArraySink(
+    JsonHandler handler,
+    size_t max_size = 0) noexcept;
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_JSON_HPP_
@@ -0,0 +1,84 @@
+/**
+ * @file
+ * @brief Интерфейс для получения метрик выполнения HTTP-запросов.
+ */
+#ifndef TASP_HTTP_METRICS_HPP_
+#define TASP_HTTP_METRICS_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Метрики выполнения HTTP-запросов всеми клиентами процесса.
+ *
+ * Метрики собираются по сервисам (название в разделе services или хост и
+ * порт), методам и классам кодов ответа. Длительность запросов учитывается в
+ * гистограмме с логарифмическими интервалами.
+ */
+class [[gnu::visibility("default")]] Metrics final
+{
+public:
+    /**
+     * @brief Метрики группы запросов.
+     */
+    struct Series
+    {
+        /**
+         * @brief Название сервиса.
+         */
+        std::string service;
+
+        /**
+         * @brief Метод запроса.
+         */
+        std::string method;
+
+        /**
+         * @brief Класс кода ответа (2xx, 4xx и т.д.) или error при ошибке
+         * выполнения запроса.
+         */
+        std::string status;
+
+        /**
+         * @brief Количество запросов.
+         */
+        uint64_t count{0};
+
+        /**
+         * @brief Суммарная длительность запросов.
+         */
+        std::chrono::microseconds sum{0};
+
+        /**
+         * @brief Интервалы гистограммы длительности: верхняя граница
+         * интервала и количество запросов с длительностью не более границы.
+         * Последний интервал не ограничен сверху и содержит все запросы.
+         */
+        std::vector<std::pair<std::chrono::microseconds, uint64_t>> buckets;
+    };
+
+    /**
+     * @brief Запрос текущих значений метрик.
+     *
+     * @return Метрики групп, в которых выполнялись запросы
+     */
+    [[nodiscard]] static std::vector<Series> Snapshot() noexcept;
+
+    /**
+     * @brief Формирование метрик в текстовом формате Prometheus.
+     *
+     * @return Метрики tasp_http_client_requests_total и
+     * tasp_http_client_request_duration_seconds
+     */
+    [[nodiscard]] static std::string Prometheus() noexcept;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_METRICS_HPP_
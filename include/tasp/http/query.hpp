@@ -0,0 +1,96 @@
+/**
+ * @file
+ * @brief Интерфейс для формирования строки параметров запроса.
+ */
+#ifndef TASP_HTTP_QUERY_HPP_
+#define TASP_HTTP_QUERY_HPP_
+
+#include <string>
+#include <string_view>
+
+#include <tasp/http/uri.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Формирование строки параметров запроса в формате
+ * name=value&name=value1,value2.
+ *
+ * Названия и значения кодируются (percent-encoding) сразу в общий буфер,
+ * все символы, кроме A-Z, a-z, 0-9, -, ., _ и ~, заменяются на %XX. Буфер
+ * сохраняется после очистки, поэтому объект можно использовать повторно без
+ * выделения памяти.
+ */
+class [[gnu::visibility("default")]] QueryBuilder final
+{
+public:
+    /**
+     * @brief Конструктор.
+     */
+    QueryBuilder() noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~QueryBuilder() noexcept;
+
+    /**
+     * @brief Добавление параметра.
+     *
+     * @param name Название параметра
+     * @param value Значение параметра
+     */
+    void Append(std::string_view name, std::string_view value) noexcept;
+
+    /**
+     * @brief Добавление параметра с несколькими значениями, разделенными
+     * запятой.
+     *
+     * @param name Название параметра
+     * @param values Значения параметра
+     */
+    void Append(std::string_view name,
+                const url::ParamValueVector &values) noexcept;
+
+    /**
+     * @brief Резервирование памяти буфера.
+     *
+     * @param size Размер строки параметров в байтах
+     */
+    void Reserve(size_t size) noexcept;
+
+    /**
+     * @brief Удаление всех параметров с сохранением буфера.
+     */
+    void Clear() noexcept;
+
+    /**
+     * @brief Запрос строки параметров для передачи в Client::SetQuery.
+     *
+     * @return Строка параметров в закодированном виде без символа ?
+     */
+    [[nodiscard]] std::string_view View() const noexcept;
+
+    QueryBuilder(const QueryBuilder &) = delete;
+    QueryBuilder(QueryBuilder &&) = delete;
+    QueryBuilder &operator=(const QueryBuilder &) = delete;
+    QueryBuilder &operator=(QueryBuilder &&) = delete;
+
+private:
+    /**
+     * @brief Добавление закодированной строки в буфер.
+     *
+     * @param value Строка
+     */
+    void Encode(std::string_view value) noexcept;
+
+    /**
+     * @brief Строка параметров.
+     */
+    std::string buffer_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_QUERY_HPP_
@@ -0,0 +1,68 @@
+/**
+ * @file
+ * @brief Интерфейс для преобразования параметров запроса в SQL-условие.
+ */
+#ifndef TASP_HTTP_SQL_HPP_
+#define TASP_HTTP_SQL_HPP_
+
+#include <string>
+#include <vector>
+
+#include <tasp/http/uri.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief SQL-условие с параметрами для подготовленного запроса.
+ *
+ * Условие содержит только названия параметров запроса и метки подстановки,
+ * поэтому для запросов с одинаковым набором параметров совпадает, и
+ * подготовленный запрос к базе данных можно использовать повторно.
+ */
+struct SQLCondition
+{
+    /**
+     * @brief Формат метки подстановки значения.
+     */
+    enum class Placeholder
+    {
+        Numbered,  ///< $1, $2, ... (PostgreSQL)
+        Question   ///< ? (SQLite, MySQL, ODBC)
+    };
+
+    /**
+     * @brief Условие для конкатенации с 'WHERE', пустое - параметров нет.
+     */
+    std::string sql;
+
+    /**
+     * @brief Значения для подстановки в порядке меток.
+     */
+    std::vector<std::string> values;
+};
+
+/**
+ * @brief Преобразование параметров запроса в SQL-условие с метками
+ * подстановки значений.
+ *
+ * Параметр с одним значением преобразуется в name = $N, с несколькими
+ * значениями - в name IN ($N, $M), условия объединяются через AND в
+ * порядке названий параметров, поэтому для одного набора параметров условие
+ * не зависит от их порядка в строке параметров.
+ * Параметры, название которых не является идентификатором SQL (буквы,
+ * цифры, _ и ., не начинается с цифры), пропускаются.
+ *
+ * @param uri URI запроса, полученный от клиента библиотеки
+ * @param placeholder Формат метки подстановки
+ *
+ * @return SQL-условие, пустое для URI, созданных вне библиотеки
+ */
+[[nodiscard]] [[gnu::visibility("default")]] SQLCondition ToSQLCondition(
+    const Uri &uri,
+    SQLCondition::Placeholder placeholder =
+        SQLCondition::Placeholder::Numbered) noexcept;
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_SQL_HPP_
@@ -0,0 +1,84 @@
+/**
+ * @file
+ * @brief Интерфейс для получения временных характеристик HTTP-запроса.
+ */
+#ifndef TASP_HTTP_TIMING_HPP_
+#define TASP_HTTP_TIMING_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+#include <tasp/http/response.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Временные характеристики выполнения HTTP-запроса.
+ *
+ * Все интервалы отсчитываются от начала выполнения запроса до завершения
+ * соответствующего этапа, значение 0 означает, что этап не выполнялся.
+ */
+struct Timing
+{
+    /**
+     * @brief Разрешение имени хоста (DNS).
+     */
+    std::chrono::microseconds name_lookup{0};
+
+    /**
+     * @brief Установление TCP-соединения.
+     */
+    std::chrono::microseconds connect{0};
+
+    /**
+     * @brief Установление TLS-соединения.
+     */
+    std::chrono::microseconds tls_handshake{0};
+
+    /**
+     * @brief Готовность к началу передачи запроса.
+     */
+    std::chrono::microseconds pre_transfer{0};
+
+    /**
+     * @brief Получение первого байта ответа (TTFB).
+     */
+    std::chrono::microseconds first_byte{0};
+
+    /**
+     * @brief Полное выполнение запроса.
+     */
+    std::chrono::microseconds total{0};
+
+    /**
+     * @brief Количество переданных байт данных запроса.
+     */
+    uint64_t bytes_sent{0};
+
+    /**
+     * @brief Количество полученных байт данных ответа.
+     */
+    uint64_t bytes_received{0};
+
+    /**
+     * @brief Признак использования ранее открытого соединения, false - если
+     * соединение не было установлено.
+     */
+    bool connection_reused{false};
+};
+
+/**
+ * @brief Запрос временных характеристик выполнения запроса.
+ *
+ * @param response Ответ, полученный от клиента библиотеки
+ *
+ * @return Временные характеристики, пустые для ответов, созданных вне
+ * библиотеки
+ */
+[[nodiscard]] [[gnu::visibility("default")]] Timing GetTiming(
+    const Response &response) noexcept;
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_TIMING_HPP_
@@ -0,0 +1,34 @@
+#include "tasp/http/batch.hpp"
+
+#include "batch_impl.hpp"
+
+using std::make_unique;
+using std::vector;
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    Batch
+------------------------------------------------------------------------------*/
+Batch::Batch() noexcept
+: impl_(make_unique<BatchImpl>())
+{
+}
+
+//------------------------------------------------------------------------------
+Batch::~Batch() noexcept = default;
+
+//------------------------------------------------------------------------------
+void Batch::Add(const Client &client) noexcept
+{
+    impl_->Add(client.impl_.get());
+}
+
+//------------------------------------------------------------------------------
+vector<Batch::Result> Batch::Send() const noexcept
+{
+    return impl_->Send();
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,84 @@
+#include "batch_impl.hpp"
+
+#include <unordered_set>
+
+#include <tasp/logging.hpp>
+
+#include "curl/multi.hpp"
+
+using std::make_shared;
+using std::unordered_set;
+using std::vector;
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    BatchImpl
+------------------------------------------------------------------------------*/
+BatchImpl::BatchImpl() noexcept = default;
+
+//------------------------------------------------------------------------------
+BatchImpl::~BatchImpl() noexcept = default;
+
+//------------------------------------------------------------------------------
+void BatchImpl::Add(const ClientImpl *client) noexcept
+{
+    clients_.push_back(client);
+}
+
+//------------------------------------------------------------------------------
+vector<Batch::Result> BatchImpl::Send() const noexcept
+{
+    static constexpr int poll_timeout{1000};
+
+    vector<Batch::Result> results(clients_.size());
+
+    Multi multi;
+    unordered_set<const ClientImpl *> added_clients;
+
+    for (size_t index = 0; index < clients_.size(); ++index)
+    {
+        const auto *client = clients_[index];
+        auto &result = results[index];
+
+        if (!added_clients.insert(client).second)
+        {
+            Logging::Error("Повторное добавление клиента в группу запросов");
+
+            auto response = make_shared<ResponseImpl>(nullptr);
+            client->Complete(*response, CURLE_FAILED_INIT);
+            result.response = response;
+            continue;
+        }
+
+        auto response = client->Prepare();
+        result.response = response;
+
+        const bool added = multi.Add(
+            client->Handle(),
+            [client, response, &result](CURLcode code)
+            {
+                client->Complete(*response, code);
+
+                result.completed = code == CURLE_OK;
+                result.duration = response->GetTiming().total;
+            });
+
+        if (!added)
+        {
+            client->Complete(*response, CURLE_FAILED_INIT);
+        }
+    }
+
+    multi.Perform();
+    while (!multi.Empty())
+    {
+        multi.Poll(poll_timeout);
+        multi.Perform();
+    }
+
+    return results;
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,63 @@
+/**
+ * @file
+ * @brief Реализация интерфейса для параллельного выполнения группы
+ * HTTP-запросов.
+ */
+#ifndef TASP_BATCH_IMPL_HPP_
+#define TASP_BATCH_IMPL_HPP_
+
+#include <vector>
+
+#include <tasp/http/batch.hpp>
+
+#include "client_impl.hpp"
+
+namespace tasp::http
+{
+
+/**
+ * @brief Реализация интерфейса для параллельного выполнения группы
+ * HTTP-запросов.
+ */
+class BatchImpl final
+{
+public:
+    /**
+     * @brief Конструктор.
+     */
+    BatchImpl() noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~BatchImpl() noexcept;
+
+    /**
+     * @brief Добавление запроса в группу.
+     *
+     * @param client Реализация клиента с настроенным запросом
+     */
+    void Add(const ClientImpl *client) noexcept;
+
+    /**
+     * @brief Выполнение запросов группы.
+     *
+     * @return Результаты в порядке добавления запросов
+     */
+    [[nodiscard]] std::vector<Batch::Result> Send() const noexcept;
+
+    BatchImpl(const BatchImpl &) = delete;
+    BatchImpl(BatchImpl &&) = delete;
+    BatchImpl &operator=(const BatchImpl &) = delete;
+    BatchImpl &operator=(BatchImpl &&) = delete;
+
+private:
+    /**
+     * @brief Клиенты группы.
+     */
+    std::vector<const ClientImpl *> clients_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_BATCH_IMPL_HPP_
@@ -0,0 +1,40 @@
+#include "tasp/http/cancellation.hpp"
+
+using std::atomic;
+using std::make_shared;
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    CancellationToken
+------------------------------------------------------------------------------*/
+CancellationToken::CancellationToken() noexcept
+: state_(make_shared<atomic<bool>>(false))
+{
+}
+
+//------------------------------------------------------------------------------
+CancellationToken::~CancellationToken() noexcept = default;
+
+//------------------------------------------------------------------------------
+CancellationToken::CancellationToken(const CancellationToken &other) noexcept =
+    default;
+
+//------------------------------------------------------------------------------
+CancellationToken &CancellationToken::operator=(
+    const CancellationToken &other) noexcept = default;
+
+//------------------------------------------------------------------------------
+void CancellationToken::Cancel() const noexcept
+{
+    state_->store(true, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+bool CancellationToken::IsCancelled() const noexcept
+{
+    return state_->load(std::memory_order_relaxed);
+}
+
+}  // namespace tasp::http
@@ -2,10 +2,13 @@
 
 #include "client_impl.hpp"
 
+using std::function;
+using std::future;
 using std::make_unique;
 using std::shared_ptr;
 using std::string;
 using std::string_view;
+using std::chrono::steady_clock;
 
 namespace tasp::http
 {
@@ -32,6 +35,18 @@ Client::Client(std::string_view config,
 //------------------------------------------------------------------------------
 Client::~Client() noexcept = default;
 
+//------------------------------------------------------------------------------
+Client::Client(Client &&other) noexcept = default;
+
+//------------------------------------------------------------------------------
+Client &Client::operator=(Client &&other) noexcept = default;
+
+//------------------------------------------------------------------------------
+void Client::ReloadServices() noexcept
+{
+    ServiceRegistry::Instance().Invalidate();
+}
+
 //------------------------------------------------------------------------------
 shared_ptr<http::Request> Client::Request() const noexcept
 {
@@ -44,4 +59,65 @@ shared_ptr<Response> Client::Send() const noexcept
     return impl_->Send();
 }
 
+//------------------------------------------------------------------------------
+future<shared_ptr<Response>> Client::SendAsync() const noexcept
+{
+    return impl_->SendAsync();
+}
+
+//------------------------------------------------------------------------------
+void Client::SendAsync(
+    function<void(shared_ptr<Response>)> callback) const noexcept
+{
+    impl_->SendAsync(std::move(callback));
+}
+
+//------------------------------------------------------------------------------
+void Client::Reset(string_view path, Request::Method method) noexcept
+{
+    impl_->Reset(path, method);
+}
+
+//------------------------------------------------------------------------------
+void Client::SetQuery(string_view query) noexcept
+{
+    impl_->SetQuery(query);
+}
+
+//------------------------------------------------------------------------------
+void Client::SetResponseSink(Sink sink, SinkEnd end) noexcept
+{
+    impl_->SetResponseSink({std::move(sink), std::move(end)});
+}
+
+//------------------------------------------------------------------------------
+void Client::SetResponseSink(int fd) noexcept
+{
+    impl_->SetResponseSink({ResponseImpl::FileSink(fd), {}});
+}
+
+//------------------------------------------------------------------------------
+void Client::SetRequestSource(Source source, int64_t length) noexcept
+{
+    impl_->SetRequestSource(std::move(source), length);
+}
+
+//------------------------------------------------------------------------------
+bool Client::SetRequestFile(string_view path) noexcept
+{
+    return impl_->SetRequestFile(path);
+}
+
+//------------------------------------------------------------------------------
+void Client::SetDeadline(steady_clock::time_point deadline) noexcept
+{
+    impl_->SetDeadline(deadline);
+}
+
+//------------------------------------------------------------------------------
+void Client::SetCancellation(const CancellationToken &token) noexcept
+{
+    impl_->SetCancellation(token);
+}
+
 }  // namespace tasp::http
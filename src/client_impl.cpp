@@ -1,15 +1,116 @@
 #include "client_impl.hpp"
 
+#include <algorithm>
+#include <thread>
+#include <utility>
+
 #include <tasp/logging.hpp>
 
+#include "curl/engine.hpp"
+#include "curl/pool.hpp"
+#include "curl/share.hpp"
+#include "request_log.hpp"
+#include "transport_error.hpp"
+
+using std::function;
+using std::optional;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+using std::future;
 using std::make_shared;
 using std::shared_ptr;
-using std::string;
 using std::string_view;
 
 namespace tasp::http
 {
 
+/**
+ * @brief Состояние асинхронного выполнения запроса с повторными и
+ * дублирующими попытками. После запуска используется только из потока цикла
+ * обработки событий.
+ */
+struct ClientImpl::Transfer
+{
+    /**
+     * @brief Указатель на главную структуру библиотеки CURL.
+     */
+    shared_ptr<CURL> curl;
+
+    /**
+     * @brief Параметры сервиса.
+     */
+    shared_ptr<const ServiceConfig> service;
+
+    /**
+     * @brief Параметры запроса.
+     */
+    shared_ptr<RequestImpl> request;
+
+    /**
+     * @brief Функции приема данных ответа.
+     */
+    ResponseImpl::Sink sink;
+
+    /**
+     * @brief Функция, вызываемая по завершении запроса.
+     */
+    function<void(shared_ptr<Response>)> callback;
+
+    /**
+     * @brief Номер текущей попытки, начиная с 0.
+     */
+    int attempt{0};
+
+    /**
+     * @brief Признак завершения текущей попытки.
+     */
+    bool done{false};
+
+    /**
+     * @brief Количество выполняемых запросов текущей попытки: основного и
+     * дублирующего.
+     */
+    int running{0};
+
+    /**
+     * @brief Указатель на структуру дублирующего запроса текущей попытки.
+     */
+    shared_ptr<CURL> hedge;
+
+    /**
+     * @brief Крайний срок выполнения запроса.
+     */
+    steady_clock::time_point deadline{steady_clock::time_point::max()};
+
+    /**
+     * @brief Признак отмены запроса.
+     */
+    shared_ptr<std::atomic<bool>> cancelled;
+
+    /**
+     * @brief Узел сервиса текущей попытки.
+     */
+    LoadBalancer::Endpoint *endpoint{nullptr};
+
+    /**
+     * @brief Узел сервиса дублирующего запроса текущей попытки.
+     */
+    LoadBalancer::Endpoint *hedge_endpoint{nullptr};
+
+    /**
+     * @brief Признак передачи балансировщику результата основного запроса
+     * попытки.
+     */
+    bool endpoint_reported{false};
+
+    /**
+     * @brief Признак передачи балансировщику результата дублирующего запроса
+     * попытки.
+     */
+    bool hedge_reported{false};
+};
+
 /*------------------------------------------------------------------------------
     ClientImpl
 ------------------------------------------------------------------------------*/
@@ -18,7 +119,8 @@ ClientImpl::ClientImpl(string_view host,
 
                        string_view path,
                        Request::Method method) noexcept
-: curl_(curl_easy_init(), curl_easy_cleanup)
+: service_(make_shared<ServiceConfig>(ServiceConfig::Address(host, port)))
+, curl_(Pool::Instance()->Acquire(service_->Origin()))
 , request_(make_shared<RequestImpl>(host, port, path, method, curl_))
 {
     Init();
@@ -29,8 +131,9 @@ ClientImpl::ClientImpl(string_view config,
 
                        string_view path,
                        Request::Method method) noexcept
-: curl_(curl_easy_init(), curl_easy_cleanup)
-, request_(make_shared<RequestImpl>(config, path, method, curl_))
+: service_(ServiceRegistry::Instance().Get(config))
+, curl_(Pool::Instance()->Acquire(service_->Origin()))
+, request_(make_shared<RequestImpl>(*service_, path, method, curl_))
 {
     Init();
 }
@@ -45,6 +148,47 @@ void ClientImpl::Init() noexcept
     curl_easy_setopt(
         curl_.get(), CURLOPT_READFUNCTION, RequestImpl::ReadDataCallback);
     curl_easy_setopt(curl_.get(), CURLOPT_READDATA, request_.get());
+
+    Share::Instance().Attach(curl_.get(), service_->share);
+
+    curl_easy_setopt(curl_.get(), CURLOPT_HTTP_VERSION, service_->http_version);
+    if (service_->http_version >= CURL_HTTP_VERSION_2_0)
+    {
+        curl_easy_setopt(curl_.get(), CURLOPT_PIPEWAIT, 1L);
+    }
+
+    curl_easy_setopt(curl_.get(),
+                     CURLOPT_MAXFILESIZE_LARGE,
+                     curl_off_t{service_->max_body_size});
+
+    if (service_->connect_timeout.count() != 0)
+    {
+        curl_easy_setopt(curl_.get(),
+                         CURLOPT_CONNECTTIMEOUT_MS,
+                         static_cast<long>(  // NOLINT(google-runtime-int)
+                             service_->connect_timeout.count()));
+    }
+
+    if (service_->low_speed_limit != 0)
+    {
+        curl_easy_setopt(
+            curl_.get(), CURLOPT_LOW_SPEED_LIMIT, service_->low_speed_limit);
+        curl_easy_setopt(curl_.get(),
+                         CURLOPT_LOW_SPEED_TIME,
+                         static_cast<long>(  // NOLINT(google-runtime-int)
+                             service_->low_speed_time.count()));
+    }
+
+    // Ответ распаковывается библиотекой CURL до передачи в функцию приема,
+    // ограничение размера ответа применяется к распакованным данным.
+    if (!service_->accept_encoding.empty())
+    {
+        curl_easy_setopt(curl_.get(),
+                         CURLOPT_ACCEPT_ENCODING,
+                         service_->accept_encoding == "all"
+                             ? ""
+                             : service_->accept_encoding.c_str());
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -59,37 +203,568 @@ shared_ptr<http::Request> ClientImpl::Request() const noexcept
 //------------------------------------------------------------------------------
 shared_ptr<Response> ClientImpl::Send() const noexcept
 {
-    request_->Header()->Set("Content-Type",
-                            request_->Data()->GetType() + "; charset=UTF-8");
+    // Дублирующие запросы выполняются параллельно основному, поэтому
+    // требуют цикла обработки событий.
+    if (service_->retry.hedge_delay.count() != 0 &&
+        !Engine::Instance().InThread())
+    {
+        return SendAsync().get();
+    }
+
+    service_->retry_budget->Deposit();
+    request_->Compress(service_->compress_min_size, service_->compress_level);
+
+    Transfer transfer;
+    transfer.service = service_;
+    transfer.request = request_;
+    transfer.deadline = Deadline();
+    transfer.cancelled = cancelled_;
+
+    for (;; ++transfer.attempt)
+    {
+        transfer.endpoint = Route(*service_, *request_, transfer.endpoint);
+
+        auto response = Prepare(curl_, *service_, *request_, sink_);
+        ApplyDeadline(curl_.get(), transfer.deadline);
 
-    const string method = Request::MethodToString(request_->GetMethod());
-    const string &url = request_->Uri()->Url();
+        const CURLcode result = curl_easy_perform(curl_.get());
+        const int64_t code = Complete(curl_.get(),
+                                      *service_,
+                                      *request_,
+                                      *response,
+                                      result,
+                                      transfer.endpoint);
 
-    auto response = make_shared<ResponseImpl>(curl_);
+        const auto delay = Retry(transfer, *response, result, code);
+        if (!delay)
+        {
+            return response;
+        }
 
-    curl_easy_setopt(curl_.get(), CURLOPT_UPLOAD, request_->Data()->Length());
+        std::this_thread::sleep_for(*delay);
+    }
+}
+
+//------------------------------------------------------------------------------
+future<shared_ptr<Response>> ClientImpl::SendAsync() const noexcept
+{
+    auto promise = make_shared<std::promise<shared_ptr<Response>>>();
+    auto result = promise->get_future();
 
-    curl_easy_setopt(curl_.get(), CURLOPT_HEADERDATA, response->Header().get());
-    curl_easy_setopt(curl_.get(), CURLOPT_WRITEDATA, response.get());
+    SendAsync([promise](shared_ptr<Response> response)
+              { promise->set_value(std::move(response)); });
 
-    const CURLcode result = curl_easy_perform(curl_.get());
+    return result;
+}
 
-    int64_t code{404};
+//------------------------------------------------------------------------------
+void ClientImpl::SendAsync(
+    function<void(shared_ptr<Response>)> callback) const noexcept
+{
+    service_->retry_budget->Deposit();
+    request_->Compress(service_->compress_min_size, service_->compress_level);
+
+    auto transfer = make_shared<Transfer>();
+    transfer->curl = curl_;
+    transfer->service = service_;
+    transfer->request = request_;
+    transfer->sink = sink_;
+    transfer->callback = std::move(callback);
+    transfer->deadline = Deadline();
+    transfer->cancelled = cancelled_;
+
+    Start(transfer);
+}
+
+//------------------------------------------------------------------------------
+void ClientImpl::Reset(string_view path, Request::Method method) noexcept
+{
+    request_->Reset(path, method);
+}
+
+//------------------------------------------------------------------------------
+void ClientImpl::SetQuery(string_view query) noexcept
+{
+    request_->SetQuery(query);
+}
+
+//------------------------------------------------------------------------------
+void ClientImpl::SetResponseSink(ResponseImpl::Sink sink) noexcept
+{
+    sink_ = std::move(sink);
+}
+
+//------------------------------------------------------------------------------
+void ClientImpl::SetRequestSource(RequestImpl::Source source,
+                                  int64_t length) noexcept
+{
+    request_->SetSource(std::move(source), length);
+}
+
+//------------------------------------------------------------------------------
+bool ClientImpl::SetRequestFile(string_view path) noexcept
+{
+    return request_->SetFile(path);
+}
+
+//------------------------------------------------------------------------------
+void ClientImpl::SetDeadline(steady_clock::time_point deadline) noexcept
+{
+    deadline_ = deadline;
+}
+
+//------------------------------------------------------------------------------
+void ClientImpl::SetCancellation(const CancellationToken &token) noexcept
+{
+    cancelled_ = token.state_;
+
+    curl_easy_setopt(curl_.get(), CURLOPT_XFERINFOFUNCTION, ProgressCallback);
+    curl_easy_setopt(curl_.get(), CURLOPT_XFERINFODATA, cancelled_.get());
+    curl_easy_setopt(curl_.get(), CURLOPT_NOPROGRESS, 0L);
+}
+
+//------------------------------------------------------------------------------
+shared_ptr<ResponseImpl> ClientImpl::Prepare() const noexcept
+{
+    endpoint_ = Route(*service_, *request_, nullptr);
+    request_->Compress(service_->compress_min_size, service_->compress_level);
+
+    auto response = Prepare(curl_, *service_, *request_, sink_);
+    ApplyDeadline(curl_.get(), Deadline());
+
+    return response;
+}
+
+//------------------------------------------------------------------------------
+shared_ptr<ResponseImpl> ClientImpl::Prepare(
+    const shared_ptr<CURL> &curl,
+    const ServiceConfig &service,
+    RequestImpl &request,
+    const ResponseImpl::Sink &sink) noexcept
+{
+    request.Header()->Set("Content-Type",
+                          request.Data()->GetType() + "; charset=UTF-8");
+    request.ApplyHeader();
+
+    const curl_off_t length = request.BodyLength();
+    request.Rewind();
+
+    curl_easy_setopt(curl.get(), CURLOPT_UPLOAD, length != 0 ? 1L : 0L);
+    curl_easy_setopt(curl.get(), CURLOPT_INFILESIZE_LARGE, length);
+
+    return Attach(curl, service, sink);
+}
+
+//------------------------------------------------------------------------------
+LoadBalancer::Endpoint *ClientImpl::Route(
+    const ServiceConfig &service,
+    RequestImpl &request,
+    const LoadBalancer::Endpoint *exclude) noexcept
+{
+    if (!service.balancer)
+    {
+        return nullptr;
+    }
+
+    auto *endpoint = service.balancer->Acquire(exclude);
+    request.SetEndpoint(*endpoint);
+
+    return endpoint;
+}
+
+//------------------------------------------------------------------------------
+void ClientImpl::Report(const ServiceConfig &service,
+                        LoadBalancer::Endpoint *endpoint,
+                        CURLcode result,
+                        int64_t code) noexcept
+{
     if (result == CURLcode::CURLE_OK)
     {
-        curl_easy_getinfo(curl_.get(), CURLINFO_RESPONSE_CODE, &code);
+        service.balancer->Report(endpoint, code >= 500);
+        return;
     }
-    else
+
+    const auto error = MakeTransportError(result);
+    switch (error.category)
     {
-        Logging::Error("Ошибка выполнения HTTP-запроса: {}",
-                       curl_easy_strerror(result));
+        case TransportError::Category::Aborted:
+        case TransportError::Category::Limit:
+            LoadBalancer::Release(endpoint);
+            break;
+
+        case TransportError::Category::Tls:
+        case TransportError::Category::Protocol:
+            service.balancer->Report(endpoint, true);
+            break;
+
+        default:
+            service.balancer->Report(endpoint, error.retriable);
+            break;
     }
+}
 
-    Logging::Info("HTTP-запрос {} {} {}", method, url, code);
+//------------------------------------------------------------------------------
+shared_ptr<ResponseImpl> ClientImpl::Attach(
+    const shared_ptr<CURL> &curl,
+    const ServiceConfig &service,
+    const ResponseImpl::Sink &sink) noexcept
+{
+    auto response = make_shared<ResponseImpl>(curl);
+    response->SetSink(sink);
+    response->SetMaxSize(static_cast<size_t>(service.max_body_size));
 
-    response->SetCode(static_cast<Response::Code>(code));
+    curl_easy_setopt(curl.get(), CURLOPT_HEADERDATA, response->Header().get());
+    curl_easy_setopt(curl.get(), CURLOPT_WRITEDATA, response.get());
 
     return response;
 }
 
+//------------------------------------------------------------------------------
+int64_t ClientImpl::Complete(CURL *curl,
+                             const ServiceConfig &service,
+                             const http::Request &request,
+                             ResponseImpl &response,
+                             CURLcode result,
+                             LoadBalancer::Endpoint *endpoint) noexcept
+{
+    // Ошибка обработки окончания данных функцией приема (например, неполная
+    // последняя строка JSON) считается ошибкой передачи.
+    result = response.Finish(result);
+    response.CollectTiming(curl);
+    response.SetResult(result);
+
+    // При ошибке передачи код ответа не устанавливается, ошибка доступна
+    // через GetError.
+    int64_t code{0};
+    if (result == CURLcode::CURLE_OK)
+    {
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &code);
+    }
+    else
+    {
+        Logging::Error("Ошибка выполнения HTTP-запроса {} {}: {}",
+                       Request::MethodToString(request.GetMethod()),
+                       request.Uri()->Url(),
+                       curl_easy_strerror(response.GetResult()));
+    }
+
+    response.SetCode(static_cast<Response::Code>(code));
+
+    auto &log = RequestLog::Instance();
+    if (result != CURLcode::CURLE_OK || log.Sample())
+    {
+        log.Write(request.GetMethod(),
+                  request.Uri()->Url(),
+                  code,
+                  response.GetTiming().total,
+                  response.GetResult());
+    }
+
+    if (service.metrics != nullptr)
+    {
+        service.metrics->Record(
+            request.GetMethod(), code, response.GetTiming().total);
+    }
+
+    if (endpoint != nullptr)
+    {
+        Report(service, endpoint, response.GetResult(), code);
+    }
+
+    return code;
+}
+
+//------------------------------------------------------------------------------
+int64_t ClientImpl::Complete(ResponseImpl &response,
+                             CURLcode result) const noexcept
+{
+    return Complete(curl_.get(),
+                    *service_,
+                    *request_,
+                    response,
+                    result,
+                    std::exchange(endpoint_, nullptr));
+}
+
+//------------------------------------------------------------------------------
+CURL *ClientImpl::Handle() const noexcept
+{
+    return curl_.get();
+}
+
+//------------------------------------------------------------------------------
+optional<milliseconds> ClientImpl::Retry(const Transfer &transfer,
+                                         const ResponseImpl &response,
+                                         CURLcode result,
+                                         int64_t code) noexcept
+{
+    const auto &service = *transfer.service;
+    const auto &request = *transfer.request;
+
+    if (transfer.attempt >= service.retry.attempts ||
+        !RetryPolicy::Retryable(request.GetMethod(), result, code) ||
+        !request.Rewindable())
+    {
+        return std::nullopt;
+    }
+
+    if (transfer.cancelled && transfer.cancelled->load())
+    {
+        return std::nullopt;
+    }
+
+    // Данные, переданные в функцию приема, не могут быть отозваны.
+    if (response.HasSink() && response.GetTiming().bytes_received != 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto delay = service.retry.Backoff(transfer.attempt);
+    if (steady_clock::now() + delay >= transfer.deadline)
+    {
+        return std::nullopt;
+    }
+
+    if (!service.retry_budget->Withdraw())
+    {
+        return std::nullopt;
+    }
+
+    return delay;
+}
+
+//------------------------------------------------------------------------------
+steady_clock::time_point ClientImpl::Deadline() const noexcept
+{
+    if (service_->timeout.count() == 0)
+    {
+        return deadline_;
+    }
+
+    return std::min(deadline_, steady_clock::now() + service_->timeout);
+}
+
+//------------------------------------------------------------------------------
+void ClientImpl::ApplyDeadline(CURL *curl,
+                               steady_clock::time_point deadline) noexcept
+{
+    long timeout{0};  // NOLINT(google-runtime-int)
+
+    if (deadline != steady_clock::time_point::max())
+    {
+        // Истекший срок ограничивается минимальным временем, чтобы запрос
+        // завершился ошибкой CURLE_OPERATION_TIMEDOUT.
+        const auto remaining = std::chrono::ceil<milliseconds>(
+            deadline - steady_clock::now());
+        timeout = std::max<long>(remaining.count(), 1);  // NOLINT
+    }
+
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, timeout);
+}
+
+//------------------------------------------------------------------------------
+int ClientImpl::ProgressCallback(void *userdata,
+                                 [[maybe_unused]] curl_off_t dltotal,
+                                 [[maybe_unused]] curl_off_t dlnow,
+                                 [[maybe_unused]] curl_off_t ultotal,
+                                 [[maybe_unused]] curl_off_t ulnow) noexcept
+{
+    const auto *cancelled = static_cast<const std::atomic<bool> *>(userdata);
+    return cancelled->load(std::memory_order_relaxed) ? 1 : 0;
+}
+
+//------------------------------------------------------------------------------
+void ClientImpl::Start(const shared_ptr<Transfer> &transfer) noexcept
+{
+    transfer->done = false;
+    transfer->running = 1;
+    transfer->hedge.reset();
+    transfer->hedge_endpoint = nullptr;
+    transfer->endpoint_reported = false;
+    transfer->hedge_reported = false;
+
+    // Повторная попытка направляется на другой узел сервиса.
+    transfer->endpoint =
+        Route(*transfer->service, *transfer->request, transfer->endpoint);
+
+    auto response = Prepare(transfer->curl,
+                            *transfer->service,
+                            *transfer->request,
+                            transfer->sink);
+    ApplyDeadline(transfer->curl.get(), transfer->deadline);
+
+    const auto delay = HedgeDelay(*transfer);
+    const int attempt = transfer->attempt;
+
+    Engine::Instance().Send(
+        transfer->curl.get(),
+        [transfer, response](CURLcode result)
+        { Finish(transfer, transfer->curl, response, result); });
+
+    if (delay.count() != 0)
+    {
+        Engine::Instance().Schedule(
+            delay, [transfer, attempt] { Hedge(transfer, attempt); });
+    }
+}
+
+//------------------------------------------------------------------------------
+void ClientImpl::Hedge(const shared_ptr<Transfer> &transfer,
+                       int attempt) noexcept
+{
+    if (transfer->done || transfer->attempt != attempt ||
+        !transfer->service->retry_budget->Withdraw())
+    {
+        return;
+    }
+
+    // Копия структуры сохраняет параметры запроса, но использует отдельное
+    // соединение, так как основное может быть занято медленным ответом.
+    shared_ptr<CURL> curl(curl_easy_duphandle(transfer->curl.get()),
+                          curl_easy_cleanup);
+    if (!curl)
+    {
+        Logging::Error("Ошибка создания дублирующего HTTP-запроса");
+        return;
+    }
+
+    // Копия сохраняет CURLOPT_PIPEWAIT и при HTTP/2 была бы
+    // мультиплексирована в соединение основного запроса.
+    curl_easy_setopt(curl.get(), CURLOPT_PIPEWAIT, 0L);
+    curl_easy_setopt(curl.get(), CURLOPT_FRESH_CONNECT, 1L);
+
+    const auto &service = *transfer->service;
+    if (service.balancer)
+    {
+        transfer->hedge_endpoint =
+            service.balancer->Acquire(transfer->endpoint);
+
+        const auto url =
+            transfer->request->EndpointUrl(*transfer->hedge_endpoint);
+        curl_easy_setopt(curl.get(), CURLOPT_URL, url.c_str());
+    }
+
+    auto response = Attach(curl, service, transfer->sink);
+    ApplyDeadline(curl.get(), transfer->deadline);
+    transfer->hedge = curl;
+    ++transfer->running;
+
+    Engine::Instance().Send(
+        curl.get(),
+        [transfer, curl, response](CURLcode result)
+        { Finish(transfer, curl, response, result); });
+}
+
+//------------------------------------------------------------------------------
+void ClientImpl::Finish(const shared_ptr<Transfer> &transfer,
+                        const shared_ptr<CURL> &curl,
+                        const shared_ptr<ResponseImpl> &response,
+                        CURLcode result) noexcept
+{
+    if (transfer->done)
+    {
+        return;
+    }
+
+    const bool primary = curl == transfer->curl;
+    --transfer->running;
+
+    auto *endpoint = primary ? transfer->endpoint : transfer->hedge_endpoint;
+    bool &reported =
+        primary ? transfer->endpoint_reported : transfer->hedge_reported;
+
+    // Ошибка передачи одного из запросов попытки не прерывает другой:
+    // результат попытки определяется оставшимся запросом. Узел сохраняется
+    // для исключения при повторной попытке.
+    if (result != CURLcode::CURLE_OK && transfer->running != 0)
+    {
+        if (endpoint != nullptr && !reported)
+        {
+            Report(*transfer->service, endpoint, result, 0);
+            reported = true;
+        }
+        return;
+    }
+    transfer->done = true;
+
+    const auto &other = primary ? transfer->hedge : transfer->curl;
+    if (other)
+    {
+        Engine::Instance().Cancel(other.get());
+
+        auto *other_endpoint =
+            primary ? transfer->hedge_endpoint : transfer->endpoint;
+        const bool other_reported =
+            primary ? transfer->hedge_reported : transfer->endpoint_reported;
+        if (other_endpoint != nullptr && !other_reported)
+        {
+            LoadBalancer::Release(other_endpoint);
+        }
+    }
+
+    const int64_t code = Complete(curl.get(),
+                                  *transfer->service,
+                                  *transfer->request,
+                                  *response,
+                                  result,
+                                  reported ? nullptr : endpoint);
+
+    // Повторная попытка исключает узел запроса, определившего результат.
+    transfer->endpoint = endpoint;
+
+    const auto delay = Retry(*transfer, *response, result, code);
+    if (delay)
+    {
+        ++transfer->attempt;
+
+        Engine::Instance().Schedule(*delay, [transfer] { Start(transfer); });
+        return;
+    }
+
+    transfer->callback(response);
+}
+
+//------------------------------------------------------------------------------
+milliseconds ClientImpl::HedgeDelay(const Transfer &transfer) noexcept
+{
+    const auto &service = *transfer.service;
+    const auto &request = *transfer.request;
+
+    // Дублируются только идемпотентные запросы без данных, ответ которых
+    // сохраняется в объекте ответа.
+    if (service.retry.hedge_delay.count() == 0 || transfer.sink.data ||
+        request.BodyLength() != 0 ||
+        !RetryPolicy::Idempotent(request.GetMethod()))
+    {
+        return milliseconds{0};
+    }
+
+    milliseconds delay{0};
+    if (service.metrics != nullptr)
+    {
+        static constexpr double quantile{0.95};
+        const auto duration =
+            service.metrics->Quantile(request.GetMethod(), quantile);
+
+        // Квантиль в последнем, неограниченном интервале гистограммы не
+        // позволяет рассчитать задержку.
+        if (duration == microseconds::max())
+        {
+            return milliseconds{0};
+        }
+        delay = std::chrono::ceil<milliseconds>(duration);
+    }
+
+    delay = std::max(delay, service.retry.hedge_delay);
+
+    // Дублирующий запрос после окончания времени выполнения не отправляется.
+    if (transfer.deadline != steady_clock::time_point::max() &&
+        delay >= transfer.deadline - steady_clock::now())
+    {
+        return milliseconds{0};
+    }
+
+    return delay;
+}
+
 }  // namespace tasp::http
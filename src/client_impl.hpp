@@ -7,11 +7,20 @@
 
 #include <curl/curl.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
 #include <memory>
+#include <optional>
 #include <sstream>
 
+#include <tasp/http/cancellation.hpp>
+
 #include "http/request_impl.hpp"
 #include "http/response_impl.hpp"
+#include "service_config.hpp"
 
 namespace tasp::http
 {
@@ -64,17 +73,311 @@ public:
      */
     [[nodiscard]] std::shared_ptr<http::Response> Send() const noexcept;
 
+    /**
+     * @brief Асинхронное выполнение запроса.
+     *
+     * @return Будущий результат выполнения запроса
+     */
+    [[nodiscard]] std::future<std::shared_ptr<http::Response>> SendAsync()
+        const noexcept;
+
+    /**
+     * @brief Асинхронное выполнение запроса с вызовом функции по завершении.
+     *
+     * @param callback Функция, вызываемая из потока цикла обработки событий
+     */
+    void SendAsync(
+        std::function<void(std::shared_ptr<http::Response>)> callback)
+        const noexcept;
+
+    /**
+     * @brief Сброс запроса для повторного использования клиента.
+     *
+     * @param path Путь запроса
+     * @param method Метод запроса
+     */
+    void Reset(std::string_view path, Request::Method method) noexcept;
+
+    /**
+     * @brief Установка строки параметров запроса.
+     *
+     * @param query Строка параметров в закодированном виде
+     */
+    void SetQuery(std::string_view query) noexcept;
+
+    /**
+     * @brief Установка функции приема данных ответа.
+     *
+     * @param sink Функции приема данных ответа, пустая функция приема
+     * фрагментов включает сохранение данных в ответе
+     */
+    void SetResponseSink(ResponseImpl::Sink sink) noexcept;
+
+    /**
+     * @brief Установка источника данных запроса.
+     *
+     * @param source Функция чтения данных, пустая функция восстанавливает
+     * передачу данных объекта запроса
+     * @param length Размер данных в байтах или -1, если размер неизвестен
+     */
+    void SetRequestSource(RequestImpl::Source source, int64_t length) noexcept;
+
+    /**
+     * @brief Установка файла в качестве источника данных запроса.
+     *
+     * @param path Путь к файлу
+     *
+     * @return Результат открытия файла
+     */
+    bool SetRequestFile(std::string_view path) noexcept;
+
+    /**
+     * @brief Установка крайнего срока выполнения запроса.
+     *
+     * @param deadline Крайний срок, time_point::max() - без ограничения
+     */
+    void SetDeadline(std::chrono::steady_clock::time_point deadline) noexcept;
+
+    /**
+     * @brief Установка признака отмены запросов клиента.
+     *
+     * @param token Признак отмены
+     */
+    void SetCancellation(const CancellationToken &token) noexcept;
+
+    /**
+     * @brief Подготовка библиотеки CURL к выполнению запроса.
+     *
+     * @return Ответ, заполняемый в процессе выполнения запроса
+     */
+    [[nodiscard]] std::shared_ptr<ResponseImpl> Prepare() const noexcept;
+
+    /**
+     * @brief Заполнение ответа по результату выполнения запроса.
+     *
+     * Функция не обращается к объекту клиента, поэтому может вызываться после
+     * его удаления.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL
+     * @param service Параметры сервиса
+     * @param request Параметры запроса
+     * @param response Ответ на запрос
+     * @param result Результат выполнения запроса библиотекой CURL
+     * @param endpoint Узел сервиса, выполнивший запрос, или nullptr
+     *
+     * @return Код ответа, 0 - ответ не получен
+     */
+    static int64_t Complete(CURL *curl,
+                            const ServiceConfig &service,
+                            const http::Request &request,
+                            ResponseImpl &response,
+                            CURLcode result,
+                            LoadBalancer::Endpoint *endpoint) noexcept;
+
+    /**
+     * @brief Заполнение ответа по результату выполнения запроса этим
+     * клиентом.
+     *
+     * @param response Ответ на запрос
+     * @param result Результат выполнения запроса библиотекой CURL
+     *
+     * @return Код ответа, 0 - ответ не получен
+     */
+    int64_t Complete(ResponseImpl &response, CURLcode result) const noexcept;
+
+    /**
+     * @brief Запрос главной структуры библиотеки CURL клиента.
+     *
+     * @return Указатель на главную структуру библиотеки CURL
+     */
+    [[nodiscard]] CURL *Handle() const noexcept;
+
     ClientImpl(const ClientImpl &) = delete;
     ClientImpl(ClientImpl &&) = delete;
     ClientImpl &operator=(const ClientImpl &) = delete;
     ClientImpl &operator=(ClientImpl &&) = delete;
 
 private:
+    /**
+     * @brief Состояние асинхронного выполнения запроса с повторными и
+     * дублирующими попытками.
+     */
+    struct Transfer;
+
     /**
      * @brief Инициализация объекта.
      */
     void Init() noexcept;
 
+    /**
+     * @brief Подготовка библиотеки CURL к выполнению запроса.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL
+     * @param service Параметры сервиса
+     * @param request Параметры запроса
+     * @param sink Функции приема данных ответа
+     *
+     * @return Ответ, заполняемый в процессе выполнения запроса
+     */
+    [[nodiscard]] static std::shared_ptr<ResponseImpl> Prepare(
+        const std::shared_ptr<CURL> &curl,
+        const ServiceConfig &service,
+        RequestImpl &request,
+        const ResponseImpl::Sink &sink) noexcept;
+
+    /**
+     * @brief Выбор узла сервиса и направление на него запроса.
+     *
+     * @param service Параметры сервиса
+     * @param request Параметры запроса
+     * @param exclude Узел предыдущей попытки, выбираемый только при
+     * отсутствии других
+     *
+     * @return Узел сервиса или nullptr, если у сервиса один узел
+     */
+    [[nodiscard]] static LoadBalancer::Endpoint *Route(
+        const ServiceConfig &service,
+        RequestImpl &request,
+        const LoadBalancer::Endpoint *exclude) noexcept;
+
+    /**
+     * @brief Передача результата запроса балансировщику нагрузки сервиса.
+     *
+     * Прерывание запроса клиентом (отмена, отказ функции приема, превышение
+     * размера ответа) не учитывается в состоянии узла. Ошибки TLS и
+     * протокола, вызванные узлом, считаются ошибками узла, как и временные
+     * ошибки передачи и ответы 5xx.
+     *
+     * @param service Параметры сервиса
+     * @param endpoint Узел сервиса, выполнивший запрос
+     * @param result Результат выполнения запроса библиотекой CURL
+     * @param code Код ответа
+     */
+    static void Report(const ServiceConfig &service,
+                       LoadBalancer::Endpoint *endpoint,
+                       CURLcode result,
+                       int64_t code) noexcept;
+
+    /**
+     * @brief Создание ответа и подключение его к функциям приема заголовка и
+     * данных библиотеки CURL.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL
+     * @param service Параметры сервиса
+     * @param sink Функции приема данных ответа
+     *
+     * @return Ответ, заполняемый в процессе выполнения запроса
+     */
+    [[nodiscard]] static std::shared_ptr<ResponseImpl> Attach(
+        const std::shared_ptr<CURL> &curl,
+        const ServiceConfig &service,
+        const ResponseImpl::Sink &sink) noexcept;
+
+    /**
+     * @brief Проверка необходимости повторной попытки выполнения запроса с
+     * расходом бюджета повторных запросов.
+     *
+     * @param transfer Состояние выполнения запроса
+     * @param response Ответ на запрос
+     * @param result Результат выполнения запроса библиотекой CURL
+     * @param code Код ответа
+     *
+     * @return Задержка перед повторной попыткой или std::nullopt, если
+     * повторная попытка не выполняется
+     */
+    [[nodiscard]] static std::optional<std::chrono::milliseconds> Retry(
+        const Transfer &transfer,
+        const ResponseImpl &response,
+        CURLcode result,
+        int64_t code) noexcept;
+
+    /**
+     * @brief Расчет крайнего срока выполнения запроса с учетом времени
+     * выполнения запроса к сервису.
+     *
+     * @return Крайний срок
+     */
+    [[nodiscard]] std::chrono::steady_clock::time_point Deadline()
+        const noexcept;
+
+    /**
+     * @brief Ограничение времени выполнения попытки оставшимся до крайнего
+     * срока временем.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL
+     * @param deadline Крайний срок
+     */
+    static void ApplyDeadline(
+        CURL *curl, std::chrono::steady_clock::time_point deadline) noexcept;
+
+    /**
+     * @brief Функция контроля передачи для прерывания отмененных запросов,
+     * для передачи в библиотеку CURL.
+     *
+     * @param userdata Указатель на признак отмены
+     * @param dltotal Ожидаемый размер принимаемых данных
+     * @param dlnow Размер принятых данных
+     * @param ultotal Ожидаемый размер передаваемых данных
+     * @param ulnow Размер переданных данных
+     *
+     * @return 0 - продолжение передачи, 1 - прерывание
+     */
+    static int ProgressCallback(void *userdata,
+                                curl_off_t dltotal,
+                                curl_off_t dlnow,
+                                curl_off_t ultotal,
+                                curl_off_t ulnow) noexcept;
+
+    /**
+     * @brief Запуск очередной попытки асинхронного выполнения запроса.
+     *
+     * @param transfer Состояние выполнения запроса
+     */
+    static void Start(const std::shared_ptr<Transfer> &transfer) noexcept;
+
+    /**
+     * @brief Отправка дублирующего запроса, если попытка еще не завершена.
+     * Вызывается из потока цикла обработки событий.
+     *
+     * @param transfer Состояние выполнения запроса
+     * @param attempt Номер попытки, для которой отправляется дубликат
+     */
+    static void Hedge(const std::shared_ptr<Transfer> &transfer,
+                      int attempt) noexcept;
+
+    /**
+     * @brief Обработка завершения основного или дублирующего запроса.
+     * Вызывается из потока цикла обработки событий.
+     *
+     * @param transfer Состояние выполнения запроса
+     * @param curl Указатель на главную структуру библиотеки CURL, выполнившую
+     * запрос
+     * @param response Ответ на запрос
+     * @param result Результат выполнения запроса библиотекой CURL
+     */
+    static void Finish(const std::shared_ptr<Transfer> &transfer,
+                       const std::shared_ptr<CURL> &curl,
+                       const std::shared_ptr<ResponseImpl> &response,
+                       CURLcode result) noexcept;
+
+    /**
+     * @brief Расчет задержки отправки дублирующего запроса по 95-му
+     * процентилю длительности запросов к сервису.
+     *
+     * @param transfer Состояние выполнения запроса
+     *
+     * @return Задержка или 0, если дублирующий запрос не отправляется, в том
+     * числе если квантиль не ограничен или задержка превышает оставшееся
+     * время выполнения запроса
+     */
+    [[nodiscard]] static std::chrono::milliseconds HedgeDelay(
+        const Transfer &transfer) noexcept;
+
+    /**
+     * @brief Параметры сервиса.
+     */
+    std::shared_ptr<const ServiceConfig> service_;
+
     /**
      * @brief Указатель на главную структуру библиотеки CURL.
      */
@@ -83,7 +386,28 @@ private:
     /**
      * @brief Параметры запроса.
      */
-    std::shared_ptr<http::Request> request_;
+    std::shared_ptr<RequestImpl> request_;
+
+    /**
+     * @brief Функции приема данных ответа.
+     */
+    ResponseImpl::Sink sink_;
+
+    /**
+     * @brief Крайний срок выполнения запроса.
+     */
+    std::chrono::steady_clock::time_point deadline_{
+        std::chrono::steady_clock::time_point::max()};
+
+    /**
+     * @brief Признак отмены запросов.
+     */
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+
+    /**
+     * @brief Узел сервиса запроса, подготовленного для выполнения в группе.
+     */
+    mutable LoadBalancer::Endpoint *endpoint_{nullptr};
 };
 
 }  // namespace tasp::http
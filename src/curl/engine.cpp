@@ -0,0 +1,147 @@
+#include "engine.hpp"
+
+#include <algorithm>
+
+using std::function;
+using std::lock_guard;
+using std::mutex;
+using std::chrono::milliseconds;
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    Engine
+------------------------------------------------------------------------------*/
+Engine &Engine::Instance() noexcept
+{
+    static Engine engine;
+    return engine;
+}
+
+//------------------------------------------------------------------------------
+Engine::Engine() noexcept
+: thread_(&Engine::Run, this)
+{
+}
+
+//------------------------------------------------------------------------------
+Engine::~Engine() noexcept
+{
+    running_ = false;
+    multi_.Wakeup();
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    for (auto &&[curl, callback] : queue_)
+    {
+        callback(CURLE_ABORTED_BY_CALLBACK);
+    }
+}
+
+//------------------------------------------------------------------------------
+void Engine::Send(CURL *curl, Multi::Callback callback) noexcept
+{
+    {
+        const lock_guard lock(mutex_);
+        queue_.emplace_back(curl, std::move(callback));
+    }
+
+    multi_.Wakeup();
+}
+
+//------------------------------------------------------------------------------
+void Engine::Schedule(milliseconds delay, function<void()> task) noexcept
+{
+    {
+        const lock_guard lock(mutex_);
+        timers_.emplace(Clock::now() + delay, std::move(task));
+    }
+
+    multi_.Wakeup();
+}
+
+//------------------------------------------------------------------------------
+void Engine::Cancel(CURL *curl) noexcept
+{
+    {
+        const lock_guard lock(mutex_);
+        queue_.erase(std::remove_if(queue_.begin(),
+                                    queue_.end(),
+                                    [curl](const auto &transfer)
+                                    { return transfer.first == curl; }),
+                     queue_.end());
+    }
+
+    multi_.Remove(curl);
+}
+
+//------------------------------------------------------------------------------
+bool Engine::InThread() const noexcept
+{
+    return std::this_thread::get_id() == thread_.get_id();
+}
+
+//------------------------------------------------------------------------------
+void Engine::Run() noexcept
+{
+    static constexpr milliseconds poll_timeout{1000};
+
+    decltype(queue_) pending;
+    std::vector<function<void()>> tasks;
+
+    while (running_)
+    {
+        {
+            const lock_guard lock(mutex_);
+
+            const auto now = Clock::now();
+            auto timer = timers_.begin();
+            for (; timer != timers_.end() && timer->first <= now; ++timer)
+            {
+                tasks.push_back(std::move(timer->second));
+            }
+            timers_.erase(timers_.begin(), timer);
+        }
+
+        for (auto &task : tasks)
+        {
+            task();
+        }
+        tasks.clear();
+
+        {
+            const lock_guard lock(mutex_);
+            pending.swap(queue_);
+        }
+
+        for (auto &&[curl, callback] : pending)
+        {
+            if (!multi_.Add(curl, std::move(callback)))
+            {
+                callback(CURLE_FAILED_INIT);
+            }
+        }
+        pending.clear();
+
+        multi_.Perform();
+
+        auto timeout = poll_timeout;
+        {
+            const lock_guard lock(mutex_);
+            if (!timers_.empty())
+            {
+                const auto delay = std::chrono::ceil<milliseconds>(
+                    timers_.begin()->first - Clock::now());
+                timeout = std::clamp(delay, milliseconds{0}, poll_timeout);
+            }
+        }
+
+        multi_.Poll(static_cast<int>(timeout.count()));
+    }
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,135 @@
+/**
+ * @file
+ * @brief Асинхронное выполнение HTTP-запросов в отдельном потоке.
+ */
+#ifndef TASP_CURL_ENGINE_HPP_
+#define TASP_CURL_ENGINE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "multi.hpp"
+
+namespace tasp::http
+{
+
+/**
+ * @brief Цикл обработки событий, выполняющий запросы всех клиентов процесса
+ * в одном потоке.
+ *
+ * Функции завершения запросов вызываются из потока цикла, поэтому не должны
+ * выполнять длительных операций.
+ */
+class Engine final
+{
+public:
+    /**
+     * @brief Запрос единственного экземпляра цикла. Поток цикла запускается
+     * при первом обращении.
+     *
+     * @return Цикл обработки событий
+     */
+    static Engine &Instance() noexcept;
+
+    /**
+     * @brief Деструктор. Останавливает поток цикла, незавершенные запросы
+     * прерываются.
+     */
+    ~Engine() noexcept;
+
+    /**
+     * @brief Постановка запроса в очередь на выполнение. Функция
+     * потокобезопасна.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL, должен
+     * оставаться действительным до вызова функции завершения
+     * @param callback Функция, вызываемая по завершении запроса
+     */
+    void Send(CURL *curl, Multi::Callback callback) noexcept;
+
+    /**
+     * @brief Отложенный вызов функции из потока цикла. Функция
+     * потокобезопасна.
+     *
+     * @param delay Задержка вызова
+     * @param task Вызываемая функция
+     */
+    void Schedule(std::chrono::milliseconds delay,
+                  std::function<void()> task) noexcept;
+
+    /**
+     * @brief Прерывание запроса без вызова функции завершения. Функция
+     * вызывается только из потока цикла.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL
+     */
+    void Cancel(CURL *curl) noexcept;
+
+    /**
+     * @brief Проверка выполнения в потоке цикла.
+     *
+     * @return Признак выполнения в потоке цикла
+     */
+    [[nodiscard]] bool InThread() const noexcept;
+
+    Engine(const Engine &) = delete;
+    Engine(Engine &&) = delete;
+    Engine &operator=(const Engine &) = delete;
+    Engine &operator=(Engine &&) = delete;
+
+private:
+    /**
+     * @brief Конструктор.
+     */
+    Engine() noexcept;
+
+    /**
+     * @brief Функция потока цикла.
+     */
+    void Run() noexcept;
+
+    /**
+     * @brief Часы для отложенных вызовов.
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Выполнение запросов.
+     */
+    Multi multi_;
+
+    /**
+     * @brief Блокировка очереди запросов и отложенных вызовов.
+     */
+    std::mutex mutex_;
+
+    /**
+     * @brief Очередь запросов, ожидающих добавления в цикл.
+     */
+    std::vector<std::pair<CURL *, Multi::Callback>> queue_;
+
+    /**
+     * @brief Отложенные вызовы по времени вызова.
+     */
+    std::multimap<Clock::time_point, std::function<void()>> timers_;
+
+    /**
+     * @brief Признак работы цикла.
+     */
+    std::atomic<bool> running_{true};
+
+    /**
+     * @brief Поток цикла.
+     */
+    std::thread thread_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_CURL_ENGINE_HPP_
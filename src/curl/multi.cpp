@@ -0,0 +1,102 @@
+#include "multi.hpp"
+
+#include <tasp/logging.hpp>
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    Multi
+------------------------------------------------------------------------------*/
+Multi::Multi() noexcept
+: multi_(curl_multi_init())
+{
+    curl_multi_setopt(multi_.get(), CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+}
+
+//------------------------------------------------------------------------------
+Multi::~Multi() noexcept
+{
+    auto transfers = std::move(transfers_);
+    for (auto &&[curl, callback] : transfers)
+    {
+        curl_multi_remove_handle(multi_.get(), curl);
+        callback(CURLE_ABORTED_BY_CALLBACK);
+    }
+}
+
+//------------------------------------------------------------------------------
+bool Multi::Add(CURL *curl, Callback &&callback) noexcept
+{
+    const CURLMcode code = curl_multi_add_handle(multi_.get(), curl);
+    if (code != CURLM_OK)
+    {
+        Logging::Error("Ошибка добавления HTTP-запроса на выполнение: {}",
+                       curl_multi_strerror(code));
+        return false;
+    }
+
+    transfers_.insert_or_assign(curl, std::move(callback));
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void Multi::Remove(CURL *curl) noexcept
+{
+    if (transfers_.erase(curl) != 0)
+    {
+        curl_multi_remove_handle(multi_.get(), curl);
+    }
+}
+
+//------------------------------------------------------------------------------
+bool Multi::Empty() const noexcept
+{
+    return transfers_.empty();
+}
+
+//------------------------------------------------------------------------------
+void Multi::Perform() noexcept
+{
+    int running{0};
+    curl_multi_perform(multi_.get(), &running);
+
+    int left{0};
+    while (CURLMsg *message = curl_multi_info_read(multi_.get(), &left))
+    {
+        if (message->msg != CURLMSG_DONE)
+        {
+            continue;
+        }
+
+        CURL *curl = message->easy_handle;
+        const CURLcode result = message->data.result;
+
+        curl_multi_remove_handle(multi_.get(), curl);
+
+        auto transfer = transfers_.find(curl);
+        if (transfer == transfers_.end())
+        {
+            continue;
+        }
+
+        auto callback = std::move(transfer->second);
+        transfers_.erase(transfer);
+
+        callback(result);
+    }
+}
+
+//------------------------------------------------------------------------------
+void Multi::Poll(int timeout) noexcept
+{
+    curl_multi_poll(multi_.get(), nullptr, 0, timeout, nullptr);
+}
+
+//------------------------------------------------------------------------------
+void Multi::Wakeup() noexcept
+{
+    curl_multi_wakeup(multi_.get());
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,128 @@
+/**
+ * @file
+ * @brief Обертка над множественным интерфейсом (multi) библиотеки CURL.
+ */
+#ifndef TASP_CURL_MULTI_HPP_
+#define TASP_CURL_MULTI_HPP_
+
+#include <curl/curl.h>
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Деструктор для структуры multi библиотеки CURL.
+ */
+struct CurlMultiDeleter
+{
+    /**
+     * @brief Оператор удаления указателя.
+     *
+     * @param ptr Указатель на структуру multi библиотеки CURL.
+     */
+    void operator()(CURLM *ptr) const noexcept
+    {
+        curl_multi_cleanup(ptr);
+    }
+};
+
+/**
+ * @brief Умный указатель с деструктором с multi библиотеки CURL.
+ */
+using CurlMulti = std::unique_ptr<CURLM, CurlMultiDeleter>;
+
+/**
+ * @brief Выполнение множества запросов в одном потоке.
+ *
+ * Запросы к одному сервису по HTTP/2 мультиплексируются в одном соединении.
+ *
+ * Класс не является потокобезопасным: все методы, кроме Wakeup, должны
+ * вызываться из одного потока.
+ */
+class Multi final
+{
+public:
+    /**
+     * @brief Функция, вызываемая по завершении запроса.
+     */
+    using Callback = std::function<void(CURLcode)>;
+
+    /**
+     * @brief Конструктор.
+     */
+    Multi() noexcept;
+
+    /**
+     * @brief Деструктор.
+     *
+     * Незавершенные запросы прерываются с кодом CURLE_ABORTED_BY_CALLBACK.
+     */
+    ~Multi() noexcept;
+
+    /**
+     * @brief Добавление запроса на выполнение.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL
+     * @param callback Функция, вызываемая по завершении запроса
+     *
+     * @return Результат добавления, при ошибке функция завершения не
+     * вызывается и не перемещается
+     */
+    bool Add(CURL *curl, Callback &&callback) noexcept;
+
+    /**
+     * @brief Прерывание запроса без вызова функции завершения.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL
+     */
+    void Remove(CURL *curl) noexcept;
+
+    /**
+     * @brief Проверка отсутствия выполняемых запросов.
+     *
+     * @return Результат проверки
+     */
+    [[nodiscard]] bool Empty() const noexcept;
+
+    /**
+     * @brief Продвижение выполнения запросов и вызов функций завершения для
+     * выполненных.
+     */
+    void Perform() noexcept;
+
+    /**
+     * @brief Ожидание событий на соединениях запросов.
+     *
+     * @param timeout Максимальное время ожидания в миллисекундах
+     */
+    void Poll(int timeout) noexcept;
+
+    /**
+     * @brief Прерывание ожидания в Poll из другого потока.
+     */
+    void Wakeup() noexcept;
+
+    Multi(const Multi &) = delete;
+    Multi(Multi &&) = delete;
+    Multi &operator=(const Multi &) = delete;
+    Multi &operator=(Multi &&) = delete;
+
+private:
+    /**
+     * @brief Указатель на структуру multi библиотеки CURL.
+     */
+    CurlMulti multi_;
+
+    /**
+     * @brief Выполняемые запросы и функции их завершения.
+     */
+    std::unordered_map<CURL *, Callback> transfers_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_CURL_MULTI_HPP_
@@ -0,0 +1,113 @@
+#include "pool.hpp"
+
+#include <tasp/config.hpp>
+
+using std::deque;
+using std::lock_guard;
+using std::mutex;
+using std::shared_ptr;
+using std::string;
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    Pool
+------------------------------------------------------------------------------*/
+shared_ptr<Pool> Pool::Instance() noexcept
+{
+    static const shared_ptr<Pool> pool(new Pool());
+    return pool;
+}
+
+//------------------------------------------------------------------------------
+Pool::Pool() noexcept
+{
+    auto &config_file = ConfigGlobal::Instance();
+
+    max_idle_ =
+        static_cast<size_t>(config_file.Get<int>("http.pool.max_idle", 8));
+    idle_timeout_ = std::chrono::seconds(
+        config_file.Get<int>("http.pool.idle_timeout", 60));
+}
+
+//------------------------------------------------------------------------------
+Pool::~Pool() noexcept
+{
+    for (auto &&[origin, idle] : idle_)
+    {
+        for (auto &&handle : idle)
+        {
+            curl_easy_cleanup(handle.curl);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+shared_ptr<CURL> Pool::Acquire(const string &origin) noexcept
+{
+    CURL *curl{nullptr};
+
+    {
+        const lock_guard lock(mutex_);
+
+        auto &idle = idle_[origin];
+        Evict(idle, Clock::now());
+
+        if (!idle.empty())
+        {
+            curl = idle.back().curl;
+            idle.pop_back();
+        }
+    }
+
+    if (curl == nullptr)
+    {
+        curl = curl_easy_init();
+    }
+
+    return {curl,
+            [pool = shared_from_this(), origin](CURL *handle)
+            { pool->Release(origin, handle); }};
+}
+
+//------------------------------------------------------------------------------
+void Pool::Release(const string &origin, CURL *curl) noexcept
+{
+    if (curl == nullptr)
+    {
+        return;
+    }
+
+    curl_easy_reset(curl);
+
+    const auto now = Clock::now();
+
+    const lock_guard lock(mutex_);
+
+    for (auto &&[key, idle] : idle_)
+    {
+        Evict(idle, now);
+    }
+
+    auto &idle = idle_[origin];
+    if (idle.size() >= max_idle_)
+    {
+        curl_easy_cleanup(curl);
+        return;
+    }
+
+    idle.push_back({curl, now});
+}
+
+//------------------------------------------------------------------------------
+void Pool::Evict(deque<Idle> &idle, Clock::time_point now) const noexcept
+{
+    while (!idle.empty() && now - idle.front().since > idle_timeout_)
+    {
+        curl_easy_cleanup(idle.front().curl);
+        idle.pop_front();
+    }
+}
+
+}  // namespace tasp::http
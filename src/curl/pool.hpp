@@ -0,0 +1,137 @@
+/**
+ * @file
+ * @brief Общий для процесса пул соединений библиотеки CURL.
+ */
+#ifndef TASP_CURL_POOL_HPP_
+#define TASP_CURL_POOL_HPP_
+
+#include <curl/curl.h>
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Пул главных структур библиотеки CURL, сгруппированных по источнику
+ * (схема, хост и порт).
+ *
+ * Главная структура хранит кэш соединений, DNS и TLS-сессий, поэтому
+ * повторное использование структуры новым клиентом того же сервиса позволяет
+ * избежать повторного установления соединения.
+ *
+ * Параметры пула загружаются из раздела http.pool глобального
+ * конфигурационного файла:
+ * - max_idle - максимальное количество свободных структур на источник;
+ * - idle_timeout - время хранения свободной структуры в секундах.
+ */
+class Pool final : public std::enable_shared_from_this<Pool>
+{
+public:
+    /**
+     * @brief Запрос единственного экземпляра пула.
+     *
+     * Структуры, выданные пулом, удерживают его до своего возвращения, поэтому
+     * пул корректно переживает завершение процесса.
+     *
+     * @return Пул
+     */
+    static std::shared_ptr<Pool> Instance() noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~Pool() noexcept;
+
+    /**
+     * @brief Получение главной структуры библиотеки CURL. Функция
+     * потокобезопасна.
+     *
+     * При удалении последней копии указателя структура возвращается в пул с
+     * очисткой параметров запроса, но с сохранением открытых соединений.
+     *
+     * @param origin Источник в формате schema://host:port
+     *
+     * @return Указатель на главную структуру библиотеки CURL
+     */
+    [[nodiscard]] std::shared_ptr<CURL> Acquire(
+        const std::string &origin) noexcept;
+
+    Pool(const Pool &) = delete;
+    Pool(Pool &&) = delete;
+    Pool &operator=(const Pool &) = delete;
+    Pool &operator=(Pool &&) = delete;
+
+private:
+    /**
+     * @brief Часы для контроля времени хранения.
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Свободная структура.
+     */
+    struct Idle
+    {
+        /**
+         * @brief Указатель на главную структуру библиотеки CURL.
+         */
+        CURL *curl;
+
+        /**
+         * @brief Время возвращения в пул.
+         */
+        Clock::time_point since;
+    };
+
+    /**
+     * @brief Конструктор.
+     */
+    Pool() noexcept;
+
+    /**
+     * @brief Возвращение главной структуры в пул.
+     *
+     * @param origin Источник
+     * @param curl Указатель на главную структуру библиотеки CURL
+     */
+    void Release(const std::string &origin, CURL *curl) noexcept;
+
+    /**
+     * @brief Удаление структур, время хранения которых истекло.
+     *
+     * @param idle Свободные структуры одного источника
+     * @param now Текущее время
+     */
+    void Evict(std::deque<Idle> &idle, Clock::time_point now) const noexcept;
+
+    /**
+     * @brief Максимальное количество свободных структур на источник.
+     */
+    size_t max_idle_;
+
+    /**
+     * @brief Время хранения свободной структуры.
+     */
+    std::chrono::seconds idle_timeout_;
+
+    /**
+     * @brief Блокировка списков свободных структур.
+     */
+    std::mutex mutex_;
+
+    /**
+     * @brief Свободные структуры по источникам, последние возвращенные в
+     * конце.
+     */
+    std::unordered_map<std::string, std::deque<Idle>> idle_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_CURL_POOL_HPP_
@@ -0,0 +1,65 @@
+#include "share.hpp"
+
+#include <tasp/config.hpp>
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    Share
+------------------------------------------------------------------------------*/
+Share &Share::Instance() noexcept
+{
+    static Share *const share = new Share();
+    return *share;
+}
+
+//------------------------------------------------------------------------------
+Share::Share() noexcept
+: share_(curl_share_init())
+{
+    curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, Share::Lock);
+    curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, Share::Unlock);
+    curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
+    if (ConfigGlobal::Instance().Get<bool>("http.share.connections", false))
+    {
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+    }
+}
+
+//------------------------------------------------------------------------------
+Share::~Share() noexcept
+{
+    curl_share_cleanup(share_);
+}
+
+//------------------------------------------------------------------------------
+void Share::Attach(CURL *curl, bool enabled) const noexcept
+{
+    curl_easy_setopt(curl, CURLOPT_SHARE, enabled ? share_ : nullptr);
+}
+
+//------------------------------------------------------------------------------
+void Share::Lock([[maybe_unused]] CURL *curl,
+                 curl_lock_data data,
+                 [[maybe_unused]] curl_lock_access access,
+                 void *userptr) noexcept
+{
+    auto *share = static_cast<Share *>(userptr);
+    share->mutexes_.at(data).lock();
+}
+
+//------------------------------------------------------------------------------
+void Share::Unlock([[maybe_unused]] CURL *curl,
+                   curl_lock_data data,
+                   void *userptr) noexcept
+{
+    auto *share = static_cast<Share *>(userptr);
+    share->mutexes_.at(data).unlock();
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,98 @@
+/**
+ * @file
+ * @brief Общие для процесса кэши DNS, TLS-сессий и соединений библиотеки
+ * CURL.
+ */
+#ifndef TASP_CURL_SHARE_HPP_
+#define TASP_CURL_SHARE_HPP_
+
+#include <curl/curl.h>
+
+#include <array>
+#include <mutex>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Объект совместного использования (share) библиотеки CURL.
+ *
+ * Кэши DNS и TLS-сессий разделяются всегда. Кэш соединений разделяется, если
+ * в глобальном конфигурационном файле задан параметр http.share.connections:
+ * библиотека CURL не гарантирует корректность его совместного использования
+ * из нескольких потоков одновременно.
+ */
+class Share final
+{
+public:
+    /**
+     * @brief Запрос единственного экземпляра.
+     *
+     * Объект не удаляется до завершения процесса, так как к нему могут быть
+     * подключены структуры, переживающие статические объекты.
+     *
+     * @return Объект совместного использования
+     */
+    static Share &Instance() noexcept;
+
+    /**
+     * @brief Подключение или отключение главной структуры библиотеки CURL от
+     * общих кэшей.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL
+     * @param enabled Признак подключения
+     */
+    void Attach(CURL *curl, bool enabled) const noexcept;
+
+    Share(const Share &) = delete;
+    Share(Share &&) = delete;
+    Share &operator=(const Share &) = delete;
+    Share &operator=(Share &&) = delete;
+
+private:
+    /**
+     * @brief Конструктор.
+     */
+    Share() noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~Share() noexcept;
+
+    /**
+     * @brief Функция блокировки данных, для передачи в библиотеку CURL.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL
+     * @param data Тип блокируемых данных
+     * @param access Тип доступа
+     * @param userptr Указатель на объект совместного использования
+     */
+    static void Lock(CURL *curl,
+                     curl_lock_data data,
+                     curl_lock_access access,
+                     void *userptr) noexcept;
+
+    /**
+     * @brief Функция разблокировки данных, для передачи в библиотеку CURL.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL
+     * @param data Тип разблокируемых данных
+     * @param userptr Указатель на объект совместного использования
+     */
+    static void Unlock(CURL *curl, curl_lock_data data, void *userptr) noexcept;
+
+    /**
+     * @brief Указатель на объект совместного использования библиотеки CURL.
+     */
+    CURLSH *share_;
+
+    /**
+     * @brief Блокировки по типам данных.
+     */
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> mutexes_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_CURL_SHARE_HPP_
@@ -0,0 +1,43 @@
+#include "tasp/http/header_value.hpp"
+
+#include "http/header_impl.hpp"
+
+using std::string_view;
+using std::vector;
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    HeaderValue
+------------------------------------------------------------------------------*/
+string_view GetHeaderValue(const Header &header, string_view name) noexcept
+{
+    const auto *impl = dynamic_cast<const HeaderImpl *>(&header);
+    if (impl == nullptr)
+    {
+        return header.Get(name);
+    }
+
+    return impl->Value(name);
+}
+
+//------------------------------------------------------------------------------
+vector<string_view> GetHeaderValues(const Header &header,
+                                    string_view name) noexcept
+{
+    const auto *impl = dynamic_cast<const HeaderImpl *>(&header);
+    if (impl == nullptr)
+    {
+        const string_view value = header.Get(name);
+        if (value.empty())
+        {
+            return {};
+        }
+        return {value};
+    }
+
+    return impl->Values(name);
+}
+
+}  // namespace tasp::http
@@ -1,5 +1,7 @@
 #include "header_impl.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <string>
 
 #include <tasp/logging.hpp>
@@ -7,10 +9,81 @@
 using std::shared_ptr;
 using std::string;
 using std::string_view;
+using std::vector;
 
 namespace tasp::http
 {
 
+namespace
+{
+
+/**
+ * @brief Начальный размер буфера заголовка ответа.
+ */
+constexpr size_t initial_buffer_size{1024};
+
+/**
+ * @brief Начальное количество параметров заголовка ответа.
+ */
+constexpr size_t initial_fields_count{16};
+
+/**
+ * @brief Приведение символа ASCII к нижнему регистру.
+ *
+ * @param symbol Символ
+ *
+ * @return Символ в нижнем регистре
+ */
+char ToLower(char symbol) noexcept
+{
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(symbol)));
+}
+
+/**
+ * @brief Вычисление хэша FNV-1a названия параметра без учета регистра.
+ *
+ * @param name Название параметра
+ *
+ * @return Хэш
+ */
+size_t HashName(string_view name) noexcept
+{
+    static constexpr size_t offset_basis{14695981039346656037ULL};
+    static constexpr size_t prime{1099511628211ULL};
+
+    size_t hash{offset_basis};
+    for (const char symbol : name)
+    {
+        hash ^= static_cast<unsigned char>(ToLower(symbol));
+        hash *= prime;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Удаление пробельных символов в начале и конце строки.
+ *
+ * @param value Строка
+ *
+ * @return Строка без пробельных символов
+ */
+string_view Trim(string_view value) noexcept
+{
+    static constexpr string_view spaces{" \t\r\n"};
+
+    const auto begin = value.find_first_not_of(spaces);
+    if (begin == string_view::npos)
+    {
+        return {};
+    }
+
+    const auto end = value.find_last_not_of(spaces);
+    return value.substr(begin, end - begin + 1);
+}
+
+}  // namespace
+
 /*------------------------------------------------------------------------------
     HeaderImpl
 ------------------------------------------------------------------------------*/
@@ -26,56 +99,220 @@ HeaderImpl::~HeaderImpl() noexcept = default;
 //------------------------------------------------------------------------------
 const string &HeaderImpl::Get(string_view name) const noexcept
 {
-    auto param{headers_.find(name.data())};
+    static const string empty_value;
+
+    if (type_ == Header::Type::Input)
+    {
+        const size_t index = Find(name, HashName(name));
+        if (index == fields_.size())
+        {
+            return empty_value;
+        }
+
+        const auto &field = fields_[index];
+        if (field.value.size() != field.value_length)
+        {
+            field.value.assign(ValueOf(field));
+        }
+        return field.value;
+    }
+
+    auto param{headers_.find(name)};
     if (param != headers_.end())
     {
         return param->second;
     }
 
-    static const string empty_value;
     return empty_value;
 }
 
 //------------------------------------------------------------------------------
-void HeaderImpl::Set(string_view name, string_view value) noexcept
+string_view HeaderImpl::Value(string_view name) const noexcept
 {
-    headers_.insert_or_assign(name.data(), value.data());
+    if (type_ == Header::Type::Output)
+    {
+        auto param{headers_.find(name)};
+        return param != headers_.end() ? string_view(param->second)
+                                       : string_view();
+    }
+
+    const size_t index = Find(name, HashName(name));
+    if (index == fields_.size())
+    {
+        return {};
+    }
+
+    return ValueOf(fields_[index]);
+}
+
+//------------------------------------------------------------------------------
+vector<string_view> HeaderImpl::Values(string_view name) const noexcept
+{
+    vector<string_view> values;
 
     if (type_ == Header::Type::Output)
     {
-        curl_headers_.reset(nullptr);
+        auto param{headers_.find(name)};
+        if (param != headers_.end())
+        {
+            values.emplace_back(param->second);
+        }
+        return values;
+    }
 
-        for (auto &&header : headers_)
+    const size_t hash = HashName(name);
+    for (size_t index = Find(name, hash); index < fields_.size();
+         index = Find(name, hash, index + 1))
+    {
+        values.push_back(ValueOf(fields_[index]));
+    }
+
+    return values;
+}
+
+//------------------------------------------------------------------------------
+void HeaderImpl::Set(string_view name, string_view value) noexcept
+{
+    if (type_ == Header::Type::Input)
+    {
+        const size_t hash = HashName(name);
+        for (size_t index = Find(name, hash); index < fields_.size();
+             index = Find(name, hash, index))
         {
-            string field{header.first};
-            field.append(": ").append(header.second);
-            curl_headers_.reset(
-                curl_slist_append(curl_headers_.release(), field.c_str()));
+            fields_.erase(fields_.begin() + static_cast<ptrdiff_t>(index));
         }
 
-        curl_easy_setopt(curl_.get(), CURLOPT_HTTPHEADER, curl_headers_.get());
+        Add(name, value);
+        return;
+    }
+
+    auto param{headers_.find(name)};
+    if (param == headers_.end())
+    {
+        headers_.emplace(name, value);
+        changed_ = true;
+    }
+    else if (param->second != value)
+    {
+        param->second.assign(value);
+        changed_ = true;
     }
 }
 
 //------------------------------------------------------------------------------
 void HeaderImpl::Set(string_view header) noexcept
 {
+    if (header.substr(0, 5) == "HTTP/")
+    {
+        buffer_.clear();
+        fields_.clear();
+        return;
+    }
+
     const auto pos = header.find_first_of(':');
     if (pos == string_view::npos)
     {
         return;
     }
 
-    const auto value_start{pos + 2};
-    auto value_end = header.find_last_not_of('\n');
-    if (value_end == string_view::npos)
+    Add(Trim(header.substr(0, pos)), Trim(header.substr(pos + 1)));
+}
+
+//------------------------------------------------------------------------------
+bool HeaderImpl::NameLess::operator()(string_view left,
+                                      string_view right) const noexcept
+{
+    return std::lexicographical_compare(
+        left.begin(),
+        left.end(),
+        right.begin(),
+        right.end(),
+        [](char first, char second)
+        {
+            return static_cast<unsigned char>(ToLower(first)) <
+                   static_cast<unsigned char>(ToLower(second));
+        });
+}
+
+//------------------------------------------------------------------------------
+void HeaderImpl::Add(string_view name, string_view value) noexcept
+{
+    if (buffer_.capacity() == 0)
+    {
+        buffer_.reserve(initial_buffer_size);
+        fields_.reserve(initial_fields_count);
+    }
+
+    Field field{};
+    field.hash = HashName(name);
+    field.name_offset = buffer_.size();
+    field.name_length = name.size();
+    buffer_.append(name);
+
+    field.value_offset = buffer_.size();
+    field.value_length = value.size();
+    buffer_.append(value);
+
+    fields_.push_back(std::move(field));
+}
+
+//------------------------------------------------------------------------------
+size_t HeaderImpl::Find(string_view name,
+                        size_t hash,
+                        size_t from) const noexcept
+{
+    for (size_t index = from; index < fields_.size(); ++index)
+    {
+        const auto &field = fields_[index];
+        if (field.hash != hash || field.name_length != name.size())
+        {
+            continue;
+        }
+
+        const string_view field_name{buffer_.data() + field.name_offset,
+                                     field.name_length};
+
+        bool equal{true};
+        for (size_t pos = 0; pos < name.size() && equal; ++pos)
+        {
+            equal = ToLower(field_name[pos]) == ToLower(name[pos]);
+        }
+
+        if (equal)
+        {
+            return index;
+        }
+    }
+
+    return fields_.size();
+}
+
+//------------------------------------------------------------------------------
+string_view HeaderImpl::ValueOf(const Field &field) const noexcept
+{
+    return {buffer_.data() + field.value_offset, field.value_length};
+}
+
+//------------------------------------------------------------------------------
+void HeaderImpl::Apply() noexcept
+{
+    if (type_ != Header::Type::Output || !changed_)
     {
-        value_end = header.length();
+        return;
     }
 
-    const auto value = header.substr(value_start, value_end - value_start);
+    curl_headers_.reset(nullptr);
+
+    string field;
+    for (auto &&header : headers_)
+    {
+        field.assign(header.first).append(": ").append(header.second);
+        curl_headers_.reset(
+            curl_slist_append(curl_headers_.release(), field.c_str()));
+    }
 
-    Set(header.substr(0, pos), value);
+    curl_easy_setopt(curl_.get(), CURLOPT_HTTPHEADER, curl_headers_.get());
+    changed_ = false;
 }
 
 //------------------------------------------------------------------------------
@@ -7,8 +7,11 @@
 
 #include <curl/curl.h>
 
+#include <functional>
 #include <map>
 #include <memory>
+#include <string_view>
+#include <vector>
 
 #include <tasp/http/header.hpp>
 
@@ -22,6 +25,12 @@ using CurlSList = std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)>;
 
 /**
  * @brief Реализация интерфейса для работы с заголовком HTTP-запроса.
+ *
+ * Заголовок ответа (Header::Type::Input) хранится в едином буфере без
+ * выделения памяти на каждый параметр, с сохранением повторяющихся
+ * параметров (например, Set-Cookie) и поиском без учета регистра названий.
+ * Названия параметров заголовка запроса также сравниваются без учета
+ * регистра.
  */
 class HeaderImpl : public Header
 {
@@ -43,6 +52,10 @@ public:
     /**
      * @brief Запрос параметра заголовка.
      *
+     * Для заголовка ответа строка значения формируется при первом запросе
+     * параметра, поэтому вызов не должен выполняться одновременно из
+     * нескольких потоков.
+     *
      * @param name Название параметра
      *
      * @return Значение
@@ -50,6 +63,28 @@ public:
     [[nodiscard]] const std::string &Get(
         std::string_view name) const noexcept override;
 
+    /**
+     * @brief Запрос первого значения параметра заголовка без копирования.
+     *
+     * @param name Название параметра, для заголовка ответа без учета
+     * регистра
+     *
+     * @return Значение или пустая строка, если параметр отсутствует
+     */
+    [[nodiscard]] std::string_view Value(std::string_view name) const noexcept;
+
+    /**
+     * @brief Запрос всех значений повторяющегося параметра заголовка без
+     * копирования.
+     *
+     * @param name Название параметра, для заголовка ответа без учета
+     * регистра
+     *
+     * @return Значения в порядке получения
+     */
+    [[nodiscard]] std::vector<std::string_view> Values(
+        std::string_view name) const noexcept;
+
     /**
      * @brief Установка нового значения параметра заголовка.
      *
@@ -66,6 +101,14 @@ public:
      */
     void Set(std::string_view header) noexcept;
 
+    /**
+     * @brief Передача заголовка запроса в библиотеку CURL.
+     *
+     * Список заголовков в формате библиотеки CURL формируется только при
+     * изменении значений после предыдущей передачи.
+     */
+    void Apply() noexcept;
+
     /**
      * @brief Функция для установки значений заголовка ответа, для передачи в
      * библиотеку CURL.
@@ -89,6 +132,92 @@ public:
     HeaderImpl &operator=(HeaderImpl &&) = delete;
 
 private:
+    /**
+     * @brief Параметр заголовка ответа в едином буфере.
+     */
+    struct Field
+    {
+        /**
+         * @brief Хэш названия без учета регистра.
+         */
+        size_t hash;
+
+        /**
+         * @brief Смещение названия в буфере.
+         */
+        size_t name_offset;
+
+        /**
+         * @brief Длина названия.
+         */
+        size_t name_length;
+
+        /**
+         * @brief Смещение значения в буфере.
+         */
+        size_t value_offset;
+
+        /**
+         * @brief Длина значения.
+         */
+        size_t value_length;
+
+        /**
+         * @brief Значение, сформированное при запросе через Get.
+         */
+        mutable std::string value;
+    };
+
+    /**
+     * @brief Сравнение названий параметров заголовка без учета регистра.
+     */
+    struct NameLess
+    {
+        using is_transparent = void;
+
+        /**
+         * @brief Сравнение названий.
+         *
+         * @param left Первое название
+         * @param right Второе название
+         *
+         * @return Признак того, что первое название меньше второго
+         */
+        bool operator()(std::string_view left,
+                        std::string_view right) const noexcept;
+    };
+
+    /**
+     * @brief Добавление параметра заголовка ответа.
+     *
+     * @param name Название параметра
+     * @param value Значение
+     */
+    void Add(std::string_view name, std::string_view value) noexcept;
+
+    /**
+     * @brief Поиск параметра заголовка ответа.
+     *
+     * @param name Название параметра без учета регистра
+     * @param hash Хэш названия
+     * @param from Индекс параметра, с которого начинается поиск
+     *
+     * @return Индекс параметра или количество параметров, если параметр
+     * не найден
+     */
+    [[nodiscard]] size_t Find(std::string_view name,
+                              size_t hash,
+                              size_t from = 0) const noexcept;
+
+    /**
+     * @brief Запрос значения параметра заголовка ответа.
+     *
+     * @param field Параметр
+     *
+     * @return Значение
+     */
+    [[nodiscard]] std::string_view ValueOf(const Field &field) const noexcept;
+
     /**
      * @brief Указатель на главную структуру библиотеки CURL.
      */
@@ -105,9 +234,24 @@ private:
     CurlSList curl_headers_{nullptr, curl_slist_free_all};
 
     /**
-     * @brief Значения заголовка.
+     * @brief Значения заголовка запроса по названию без учета регистра.
+     */
+    std::map<std::string, std::string, NameLess> headers_;
+
+    /**
+     * @brief Буфер названий и значений заголовка ответа.
+     */
+    std::string buffer_;
+
+    /**
+     * @brief Параметры заголовка ответа в порядке получения.
+     */
+    std::vector<Field> fields_;
+
+    /**
+     * @brief Признак изменения значений после передачи в библиотеку CURL.
      */
-    std::map<std::string, std::string> headers_;
+    bool changed_{true};
 };
 
 }  // namespace tasp::http
@@ -0,0 +1,328 @@
+#include "json_splitter.hpp"
+
+#include <exception>
+
+#include <tasp/logging.hpp>
+
+using std::string;
+using std::string_view;
+
+namespace tasp::http
+{
+
+namespace
+{
+
+/**
+ * @brief Проверка символа-разделителя JSON.
+ *
+ * @param c Символ
+ *
+ * @return Признак пробела, табуляции или перевода строки
+ */
+constexpr bool IsSpace(char c) noexcept
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+}  // namespace
+
+/*------------------------------------------------------------------------------
+    JsonSplitter
+------------------------------------------------------------------------------*/
+JsonSplitter::JsonSplitter(Mode mode,
+                           JsonHandler handler,
+                           size_t max_size) noexcept
+: mode_(mode)
+, handler_(std::move(handler))
+, max_size_(max_size)
+{
+    Json::CharReaderBuilder builder;
+    builder["collectComments"] = false;
+    reader_.reset(builder.newCharReader());
+}
+
+//------------------------------------------------------------------------------
+JsonSplitter::~JsonSplitter() noexcept = default;
+
+//------------------------------------------------------------------------------
+bool JsonSplitter::Write(string_view chunk) noexcept
+{
+    if (failed_)
+    {
+        return false;
+    }
+
+    const bool result =
+        mode_ == Mode::Lines ? WriteLines(chunk) : WriteArray(chunk);
+    failed_ = !result;
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+bool JsonSplitter::End(Client::SinkStatus status) noexcept
+{
+    // Данные прерванной попытки неполные и не разбираются.
+    if (status == Client::SinkStatus::Aborted)
+    {
+        Reset();
+        return true;
+    }
+
+    return Finish();
+}
+
+//------------------------------------------------------------------------------
+bool JsonSplitter::WriteLines(string_view chunk) noexcept
+{
+    while (!chunk.empty())
+    {
+        const size_t end = chunk.find('\n');
+        if (end == string_view::npos)
+        {
+            return Append(chunk);
+        }
+
+        string_view line = chunk.substr(0, end);
+        chunk.remove_prefix(end + 1);
+
+        if (!pending_.empty())
+        {
+            if (!Append(line))
+            {
+                return false;
+            }
+            line = pending_;
+        }
+
+        const bool result = ParseLine(line);
+        pending_.clear();
+
+        if (!result)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool JsonSplitter::WriteArray(string_view chunk) noexcept
+{
+    size_t start{0};
+
+    for (size_t index = 0; index < chunk.size(); ++index)
+    {
+        const char c = chunk[index];
+
+        switch (state_)
+        {
+            case State::Start:
+                if (IsSpace(c))
+                {
+                    continue;
+                }
+
+                if (c != '[')
+                {
+                    state_ = State::Document;
+                    return Append(chunk.substr(index));
+                }
+
+                state_ = State::Separator;
+                continue;
+
+            case State::Separator:
+                if (IsSpace(c) || c == ',')
+                {
+                    continue;
+                }
+
+                if (c == ']')
+                {
+                    state_ = State::Done;
+                    continue;
+                }
+
+                state_ = State::Element;
+                start = index;
+                depth_ = 0;
+                in_string_ = false;
+                escape_ = false;
+                break;
+
+            case State::Element:
+                break;
+
+            case State::Document:
+                return Append(chunk.substr(index));
+
+            case State::Done:
+                continue;
+        }
+
+        if (in_string_)
+        {
+            if (escape_)
+            {
+                escape_ = false;
+            }
+            else if (c == '\\')
+            {
+                escape_ = true;
+            }
+            else if (c == '"')
+            {
+                in_string_ = false;
+            }
+            continue;
+        }
+
+        if (c == '"')
+        {
+            in_string_ = true;
+        }
+        else if (c == '{' || c == '[')
+        {
+            ++depth_;
+        }
+        else if ((c == '}' || c == ']') && depth_ != 0)
+        {
+            --depth_;
+        }
+        else if ((c == ']' || c == ',') && depth_ == 0)
+        {
+            // Запятая или конец массива верхнего уровня завершают элемент.
+            state_ = c == ']' ? State::Done : State::Separator;
+            if (!ParseElement(chunk.substr(start, index - start)))
+            {
+                return false;
+            }
+        }
+    }
+
+    if (state_ == State::Element)
+    {
+        return Append(chunk.substr(start));
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool JsonSplitter::Finish() noexcept
+{
+    bool result{!failed_};
+
+    if (result)
+    {
+        if (mode_ == Mode::Lines)
+        {
+            result = ParseLine(pending_);
+        }
+        else if (state_ == State::Document)
+        {
+            result = Parse(pending_);
+        }
+        else if (state_ == State::Separator || state_ == State::Element)
+        {
+            Logging::Error("Неполные данные массива JSON в HTTP-ответе");
+            result = false;
+        }
+    }
+
+    Reset();
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+void JsonSplitter::Reset() noexcept
+{
+    pending_.clear();
+    state_ = State::Start;
+    failed_ = false;
+}
+
+//------------------------------------------------------------------------------
+bool JsonSplitter::ParseLine(string_view line) noexcept
+{
+    if (!line.empty() && line.back() == '\r')
+    {
+        line.remove_suffix(1);
+    }
+
+    for (const char c : line)
+    {
+        if (!IsSpace(c))
+        {
+            return Parse(line);
+        }
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool JsonSplitter::ParseElement(string_view tail) noexcept
+{
+    if (pending_.empty())
+    {
+        return Parse(tail);
+    }
+
+    const bool result = Append(tail) && Parse(pending_);
+    pending_.clear();
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+bool JsonSplitter::Parse(string_view text) noexcept
+{
+    if (max_size_ != 0 && text.size() > max_size_)
+    {
+        Logging::Error("Размер значения JSON в HTTP-ответе превышает {} байт",
+                       max_size_);
+        return false;
+    }
+
+    string errors;
+    if (!reader_->parse(
+            text.data(), text.data() + text.size(), &value_, &errors))
+    {
+        Logging::Error("Ошибка разбора JSON в HTTP-ответе: {}", errors);
+        return false;
+    }
+
+    try
+    {
+        return handler_(value_);
+    }
+    catch (const std::exception &error)
+    {
+        Logging::Error("Ошибка обработки JSON из HTTP-ответа: {}",
+                       error.what());
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+bool JsonSplitter::Append(string_view data) noexcept
+{
+    if (max_size_ != 0 && pending_.size() + data.size() > max_size_)
+    {
+        Logging::Error("Размер значения JSON в HTTP-ответе превышает {} байт",
+                       max_size_);
+        return false;
+    }
+
+    pending_.append(data);
+
+    return true;
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,222 @@
+/**
+ * @file
+ * @brief Разделение потока данных JSON на значения для разбора по мере
+ * приема.
+ */
+#ifndef TASP_HTTP_JSON_SPLITTER_HPP_
+#define TASP_HTTP_JSON_SPLITTER_HPP_
+
+#include <json/reader.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <tasp/http/json.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Разделение данных ответа на строки JSON Lines или элементы массива
+ * JSON верхнего уровня с разбором каждого значения сразу после приема.
+ *
+ * Значения, целиком находящиеся в принятом фрагменте, разбираются без
+ * копирования, в буфере сохраняется только значение, разделенное между
+ * фрагментами. Буфер и объект значения используются повторно для всех
+ * значений и запросов.
+ */
+class JsonSplitter final
+{
+public:
+    /**
+     * @brief Формат данных.
+     */
+    enum class Mode
+    {
+        Lines,  ///< JSON Lines (NDJSON), одно значение в строке
+        Array   ///< Массив JSON, значение - элемент массива
+    };
+
+    /**
+     * @brief Конструктор.
+     *
+     * @param mode Формат данных
+     * @param handler Функция обработки разобранных значений
+     * @param max_size Максимальный размер значения в байтах, 0 - без
+     * ограничения
+     */
+    JsonSplitter(Mode mode, JsonHandler handler, size_t max_size) noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~JsonSplitter() noexcept;
+
+    /**
+     * @brief Прием фрагмента данных.
+     *
+     * @param chunk Фрагмент данных
+     *
+     * @return Признак успешного разбора и обработки значений
+     */
+    bool Write(std::string_view chunk) noexcept;
+
+    /**
+     * @brief Окончание попытки выполнения запроса.
+     *
+     * После полного приема данных разбирается оставшееся в буфере значение,
+     * после прерванной попытки данные буфера отбрасываются. В обоих случаях
+     * состояние сбрасывается для следующего запроса.
+     *
+     * @param status Результат попытки
+     *
+     * @return Признак успешного разбора и обработки значений
+     */
+    bool End(Client::SinkStatus status) noexcept;
+
+    JsonSplitter(const JsonSplitter &) = delete;
+    JsonSplitter(JsonSplitter &&) = delete;
+    JsonSplitter &operator=(const JsonSplitter &) = delete;
+    JsonSplitter &operator=(JsonSplitter &&) = delete;
+
+private:
+    /**
+     * @brief Состояние разбора массива.
+     */
+    enum class State
+    {
+        Start,      ///< Ожидание начала данных
+        Separator,  ///< Ожидание элемента, запятой или конца массива
+        Element,    ///< Прием элемента массива
+        Document,   ///< Прием данных, не являющихся массивом
+        Done        ///< Массив завершен
+    };
+
+    /**
+     * @brief Прием фрагмента данных в формате JSON Lines.
+     *
+     * @param chunk Фрагмент данных
+     *
+     * @return Признак успешного разбора и обработки значений
+     */
+    bool WriteLines(std::string_view chunk) noexcept;
+
+    /**
+     * @brief Прием фрагмента данных массива JSON.
+     *
+     * @param chunk Фрагмент данных
+     *
+     * @return Признак успешного разбора и обработки значений
+     */
+    bool WriteArray(std::string_view chunk) noexcept;
+
+    /**
+     * @brief Разбор оставшихся данных по окончании приема и сброс состояния.
+     *
+     * @return Признак успешного разбора и обработки значений
+     */
+    bool Finish() noexcept;
+
+    /**
+     * @brief Сброс состояния разбора без разбора данных буфера.
+     */
+    void Reset() noexcept;
+
+    /**
+     * @brief Разбор строки JSON Lines, пустые строки пропускаются.
+     *
+     * @param line Строка без символа перевода строки
+     *
+     * @return Признак успешного разбора и обработки значения
+     */
+    bool ParseLine(std::string_view line) noexcept;
+
+    /**
+     * @brief Завершение элемента массива, часть которого может находиться в
+     * буфере.
+     *
+     * @param tail Окончание элемента в текущем фрагменте
+     *
+     * @return Признак успешного разбора и обработки значения
+     */
+    bool ParseElement(std::string_view tail) noexcept;
+
+    /**
+     * @brief Разбор значения и передача его функции обработки.
+     *
+     * @param text Текст значения
+     *
+     * @return Признак успешного разбора и обработки значения
+     */
+    bool Parse(std::string_view text) noexcept;
+
+    /**
+     * @brief Добавление части значения в буфер.
+     *
+     * @param data Часть значения
+     *
+     * @return Признак соблюдения максимального размера значения
+     */
+    bool Append(std::string_view data) noexcept;
+
+    /**
+     * @brief Формат данных.
+     */
+    Mode mode_;
+
+    /**
+     * @brief Функция обработки разобранных значений.
+     */
+    JsonHandler handler_;
+
+    /**
+     * @brief Максимальный размер значения.
+     */
+    size_t max_size_;
+
+    /**
+     * @brief Объект разбора JSON.
+     */
+    std::unique_ptr<Json::CharReader> reader_;
+
+    /**
+     * @brief Разобранное значение.
+     */
+    Json::Value value_;
+
+    /**
+     * @brief Буфер значения, разделенного между фрагментами.
+     */
+    std::string pending_;
+
+    /**
+     * @brief Состояние разбора массива.
+     */
+    State state_{State::Start};
+
+    /**
+     * @brief Глубина вложенности объектов и массивов в элементе.
+     */
+    size_t depth_{0};
+
+    /**
+     * @brief Признак нахождения внутри строки.
+     */
+    bool in_string_{false};
+
+    /**
+     * @brief Признак экранирования следующего символа строки.
+     */
+    bool escape_{false};
+
+    /**
+     * @brief Признак ошибки, после которой данные не разбираются до
+     * окончания приема.
+     */
+    bool failed_{false};
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_JSON_SPLITTER_HPP_
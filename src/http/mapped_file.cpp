@@ -0,0 +1,110 @@
+#include "mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include <tasp/logging.hpp>
+
+using std::string;
+using std::string_view;
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    MappedFile
+------------------------------------------------------------------------------*/
+MappedFile::MappedFile(string_view path) noexcept
+{
+    const string file{path};
+
+    const int fd = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        Logging::Error(
+            "Ошибка открытия файла {}: {}", file, std::strerror(errno));
+        return;
+    }
+
+    struct stat info
+    {
+    };
+    if (fstat(fd, &info) != 0)
+    {
+        Logging::Error(
+            "Ошибка чтения свойств файла {}: {}", file, std::strerror(errno));
+        close(fd);
+        return;
+    }
+
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ != 0)
+    {
+        void *data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            Logging::Error("Ошибка отображения файла {} в память: {}",
+                           file,
+                           std::strerror(errno));
+            close(fd);
+            size_ = 0;
+            return;
+        }
+
+        madvise(data, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char *>(data);
+    }
+
+    close(fd);
+    valid_ = true;
+}
+
+//------------------------------------------------------------------------------
+MappedFile::~MappedFile() noexcept
+{
+    if (data_ != nullptr)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        munmap(const_cast<char *>(data_), size_);
+    }
+}
+
+//------------------------------------------------------------------------------
+bool MappedFile::IsValid() const noexcept
+{
+    return valid_;
+}
+
+//------------------------------------------------------------------------------
+size_t MappedFile::Size() const noexcept
+{
+    return size_;
+}
+
+//------------------------------------------------------------------------------
+size_t MappedFile::Read(char *buffer, size_t size) noexcept
+{
+    const size_t length = std::min(size, size_ - offset_);
+    if (length != 0)
+    {
+        std::memcpy(buffer, data_ + offset_, length);
+        offset_ += length;
+    }
+
+    return length;
+}
+
+//------------------------------------------------------------------------------
+void MappedFile::Rewind() noexcept
+{
+    offset_ = 0;
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,93 @@
+/**
+ * @file
+ * @brief Отображение файла в память для передачи в запросе HTTP.
+ */
+#ifndef TASP_HTTP_MAPPED_FILE_HPP_
+#define TASP_HTTP_MAPPED_FILE_HPP_
+
+#include <cstddef>
+#include <string_view>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Файл, отображенный в память только для чтения.
+ *
+ * Данные файла читаются ядром по мере обращения к страницам, поэтому передача
+ * файла не требует его полной загрузки в память процесса.
+ */
+class MappedFile final
+{
+public:
+    /**
+     * @brief Конструктор.
+     *
+     * @param path Путь к файлу
+     */
+    explicit MappedFile(std::string_view path) noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~MappedFile() noexcept;
+
+    /**
+     * @brief Проверка успешности отображения файла.
+     *
+     * @return Результат проверки
+     */
+    [[nodiscard]] bool IsValid() const noexcept;
+
+    /**
+     * @brief Запрос размера файла.
+     *
+     * @return Размер в байтах
+     */
+    [[nodiscard]] size_t Size() const noexcept;
+
+    /**
+     * @brief Чтение очередного фрагмента файла.
+     *
+     * @param buffer Буфер для записи данных
+     * @param size Размер буфера
+     *
+     * @return Количество прочитанных байт, 0 по достижении конца файла
+     */
+    size_t Read(char *buffer, size_t size) noexcept;
+
+    /**
+     * @brief Возврат позиции чтения в начало файла.
+     */
+    void Rewind() noexcept;
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile(MappedFile &&) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile &operator=(MappedFile &&) = delete;
+
+private:
+    /**
+     * @brief Начало отображенной области.
+     */
+    const char *data_{nullptr};
+
+    /**
+     * @brief Размер файла.
+     */
+    size_t size_{0};
+
+    /**
+     * @brief Позиция чтения.
+     */
+    size_t offset_{0};
+
+    /**
+     * @brief Признак успешного открытия файла.
+     */
+    bool valid_{false};
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_MAPPED_FILE_HPP_
@@ -0,0 +1,93 @@
+#include "pattern_cache.hpp"
+
+#include <mutex>
+
+#include <tasp/logging.hpp>
+
+using std::make_shared;
+using std::regex;
+using std::shared_lock;
+using std::shared_ptr;
+using std::string;
+using std::string_view;
+using std::unique_lock;
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    PatternCache
+------------------------------------------------------------------------------*/
+PatternCache &PatternCache::Instance() noexcept
+{
+    static PatternCache cache;
+    return cache;
+}
+
+//------------------------------------------------------------------------------
+PatternCache::PatternCache() noexcept = default;
+
+//------------------------------------------------------------------------------
+PatternCache::~PatternCache() noexcept = default;
+
+//------------------------------------------------------------------------------
+shared_ptr<const regex> PatternCache::Get(string_view expr) noexcept
+{
+    // Буфер ключа сохраняет выделенную память между вызовами потока.
+    thread_local string key;
+    key.assign(expr);
+
+    {
+        const shared_lock lock(mutex_);
+
+        auto pattern = patterns_.find(key);
+        if (pattern != patterns_.end())
+        {
+            return pattern->second;
+        }
+    }
+
+    auto pattern = Compile(key);
+
+    const unique_lock lock(mutex_);
+    if (patterns_.size() >= max_size)
+    {
+        return pattern;
+    }
+
+    return patterns_.try_emplace(key, std::move(pattern)).first->second;
+}
+
+//------------------------------------------------------------------------------
+bool PatternCache::MatchFailed(string_view expr) noexcept
+{
+    const unique_lock lock(mutex_);
+
+    // Сверх ограничения ошибки не записываются, чтобы не переполнить журнал.
+    if (failed_.size() >= max_size)
+    {
+        return false;
+    }
+
+    return failed_.emplace(expr).second;
+}
+
+//------------------------------------------------------------------------------
+shared_ptr<const regex> PatternCache::Compile(const string &expr) noexcept
+{
+    try
+    {
+        return make_shared<const regex>(
+            expr, regex::ECMAScript | regex::optimize);
+    }
+    catch (const std::regex_error &error)
+    {
+        Logging::Error("Ошибка компиляции регулярного выражения {}: {}",
+                       expr,
+                       error.what());
+    }
+
+    return nullptr;
+}
+
+}  // namespace tasp::http
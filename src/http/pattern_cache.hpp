@@ -0,0 +1,112 @@
+/**
+ * @file
+ * @brief Кэш скомпилированных регулярных выражений для сравнения путей.
+ */
+#ifndef TASP_HTTP_PATTERN_CACHE_HPP_
+#define TASP_HTTP_PATTERN_CACHE_HPP_
+
+#include <memory>
+#include <regex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Общий для процесса кэш скомпилированных регулярных выражений.
+ *
+ * Выражение компилируется при первом обращении и используется всеми
+ * объектами URI. Некорректные выражения также сохраняются, чтобы ошибка
+ * записывалась в журнал один раз; так же один раз для выражения
+ * записывается ошибка сравнения. Количество выражений в кэше ограничено,
+ * выражения сверх ограничения компилируются при каждом обращении.
+ */
+class PatternCache final
+{
+public:
+    /**
+     * @brief Запрос единственного экземпляра кэша.
+     *
+     * @return Кэш регулярных выражений
+     */
+    static PatternCache &Instance() noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~PatternCache() noexcept;
+
+    /**
+     * @brief Запрос скомпилированного регулярного выражения. Функция
+     * потокобезопасна.
+     *
+     * @param expr Регулярное выражение
+     *
+     * @return Скомпилированное выражение, пустой указатель - выражение
+     * некорректно
+     */
+    [[nodiscard]] std::shared_ptr<const std::regex> Get(
+        std::string_view expr) noexcept;
+
+    /**
+     * @brief Учет ошибки сравнения с регулярным выражением (например,
+     * превышения сложности). Функция потокобезопасна.
+     *
+     * @param expr Регулярное выражение
+     *
+     * @return Признак первой ошибки для выражения, которую следует записать
+     * в журнал
+     */
+    [[nodiscard]] bool MatchFailed(std::string_view expr) noexcept;
+
+    PatternCache(const PatternCache &) = delete;
+    PatternCache(PatternCache &&) = delete;
+    PatternCache &operator=(const PatternCache &) = delete;
+    PatternCache &operator=(PatternCache &&) = delete;
+
+private:
+    /**
+     * @brief Конструктор.
+     */
+    PatternCache() noexcept;
+
+    /**
+     * @brief Компиляция регулярного выражения.
+     *
+     * @param expr Регулярное выражение
+     *
+     * @return Скомпилированное выражение, пустой указатель - выражение
+     * некорректно
+     */
+    [[nodiscard]] static std::shared_ptr<const std::regex> Compile(
+        const std::string &expr) noexcept;
+
+    /**
+     * @brief Максимальное количество выражений в кэше.
+     */
+    static constexpr size_t max_size{1024};
+
+    /**
+     * @brief Блокировка кэша.
+     */
+    std::shared_mutex mutex_;
+
+    /**
+     * @brief Скомпилированные выражения по тексту выражения.
+     */
+    std::unordered_map<std::string, std::shared_ptr<const std::regex>>
+        patterns_;
+
+    /**
+     * @brief Выражения, для которых записана ошибка сравнения.
+     */
+    std::unordered_set<std::string> failed_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_PATTERN_CACHE_HPP_
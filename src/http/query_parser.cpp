@@ -0,0 +1,114 @@
+#include "query_parser.hpp"
+
+using std::string;
+using std::string_view;
+
+namespace tasp::http
+{
+
+namespace
+{
+
+/**
+ * @brief Преобразование шестнадцатеричной цифры в число.
+ *
+ * @param c Символ
+ *
+ * @return Значение цифры, -1 - символ не является цифрой
+ */
+int HexValue(char c) noexcept
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Выделение части строки до разделителя.
+ *
+ * @param value Строка, из которой удаляется выделенная часть и разделитель
+ * @param separator Разделитель
+ *
+ * @return Часть строки до разделителя
+ */
+string_view NextToken(string_view &value, char separator) noexcept
+{
+    const auto end = value.find(separator);
+    const auto token = value.substr(0, end);
+
+    value.remove_prefix(end == string_view::npos ? value.size() : end + 1);
+
+    return token;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+void ParseQuery(string_view query, QueryParams &params) noexcept
+{
+    while (!query.empty())
+    {
+        auto value = NextToken(query, '&');
+        const auto name = NextToken(value, '=');
+        if (name.empty())
+        {
+            continue;
+        }
+
+        url::ParamValueVector values;
+        do
+        {
+            values.push_back(DecodeQueryComponent(NextToken(value, ',')));
+        } while (!value.empty());
+
+        params.emplace(DecodeQueryComponent(name), std::move(values));
+    }
+}
+
+//------------------------------------------------------------------------------
+string DecodeQueryComponent(string_view value) noexcept
+{
+    string result;
+    result.reserve(value.size());
+
+    for (size_t i = 0; i < value.size(); ++i)
+    {
+        const char c = value[i];
+
+        if (c == '+')
+        {
+            result.push_back(' ');
+            continue;
+        }
+
+        // Некорректная последовательность % сохраняется без изменений.
+        if (c == '%' && i + 2 < value.size())
+        {
+            const int high = HexValue(value[i + 1]);
+            const int low = HexValue(value[i + 2]);
+            if (high >= 0 && low >= 0)
+            {
+                result.push_back(static_cast<char>(high * 16 + low));
+                i += 2;
+                continue;
+            }
+        }
+
+        result.push_back(c);
+    }
+
+    return result;
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,51 @@
+/**
+ * @file
+ * @brief Разбор строки параметров запроса.
+ */
+#ifndef TASP_HTTP_QUERY_PARSER_HPP_
+#define TASP_HTTP_QUERY_PARSER_HPP_
+
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+
+#include <tasp/http/uri.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Параметры запроса: каждое вхождение параметра в строку параметров
+ * хранится отдельно со списком значений.
+ *
+ * Вхождения одного параметра хранятся в порядке строки параметров, поиск
+ * выполняется по string_view без формирования строки.
+ */
+using QueryParams =
+    std::multimap<std::string, url::ParamValueVector, std::less<>>;
+
+/**
+ * @brief Разбор строки параметров в формате name=value1,value2&name=value.
+ *
+ * Значение параметра разделяется на список по запятым до декодирования,
+ * поэтому закодированная запятая (%2C) остается частью значения. Символ +
+ * декодируется как пробел. Параметр без символа = имеет одно пустое значение.
+ *
+ * @param query Строка параметров в закодированном виде без символа ?
+ * @param params Параметры запроса для заполнения
+ */
+void ParseQuery(std::string_view query, QueryParams &params) noexcept;
+
+/**
+ * @brief Декодирование компонента строки параметров (percent-encoding).
+ *
+ * @param value Закодированная строка
+ *
+ * @return Декодированная строка
+ */
+[[nodiscard]] std::string DecodeQueryComponent(std::string_view value) noexcept;
+
+}  // namespace tasp::http
+
+#endif  // TASP_HTTP_QUERY_PARSER_HPP_
@@ -1,5 +1,11 @@
 #include "request_impl.hpp"
 
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
 #include <tasp/logging.hpp>
 
 #include "header_impl.hpp"
@@ -27,13 +33,13 @@ RequestImpl::RequestImpl(string_view host,
 }
 
 //------------------------------------------------------------------------------
-RequestImpl::RequestImpl(string_view config,
+RequestImpl::RequestImpl(const ServiceConfig &service,
                          string_view path,
                          Request::Method method,
                          shared_ptr<CURL> curl) noexcept
 : RequestImpl(method, std::move(curl))
 {
-    uri_ = make_shared<UriImpl>(config, path, curl_);
+    uri_ = make_shared<UriImpl>(service, path, curl_);
 }
 
 //------------------------------------------------------------------------------
@@ -43,8 +49,7 @@ RequestImpl::RequestImpl(Request::Method method, shared_ptr<CURL> curl) noexcept
 , headers_(make_shared<HeaderImpl>(curl_, Header::Type::Output))
 , data_(make_shared<http::Data>())
 {
-    curl_easy_setopt(
-        curl_.get(), CURLOPT_CUSTOMREQUEST, MethodToString(method_));
+    SetMethod(method_);
 
     headers_->Set("Access-Control-Allow-Origin", "*");
 }
@@ -76,6 +81,212 @@ shared_ptr<http::Data> RequestImpl::Data() const noexcept
     return data_;
 }
 
+//------------------------------------------------------------------------------
+void RequestImpl::SetMethod(Request::Method method) noexcept
+{
+    method_ = method;
+    curl_easy_setopt(
+        curl_.get(), CURLOPT_CUSTOMREQUEST, MethodToString(method_));
+}
+
+//------------------------------------------------------------------------------
+void RequestImpl::Reset(string_view path, Request::Method method) noexcept
+{
+    SetMethod(method);
+    uri_->ChangePath(path);
+    uri_->SetQuery({});
+    data_->Set(string());
+    body_.clear();
+    body_length_ = 0;
+    SetSource({}, -1);
+
+    if (!compressed_.empty())
+    {
+        headers_->Set("Content-Encoding", "");
+        compressed_.clear();
+    }
+}
+
+//------------------------------------------------------------------------------
+void RequestImpl::SetQuery(string_view query) noexcept
+{
+    uri_->SetQuery(query);
+}
+
+//------------------------------------------------------------------------------
+void RequestImpl::SetEndpoint(const LoadBalancer::Endpoint &endpoint) noexcept
+{
+    uri_->SetEndpoint(endpoint);
+}
+
+//------------------------------------------------------------------------------
+string RequestImpl::EndpointUrl(
+    const LoadBalancer::Endpoint &endpoint) const noexcept
+{
+    return uri_->EndpointUrl(endpoint);
+}
+
+//------------------------------------------------------------------------------
+void RequestImpl::SetSource(Source source, int64_t length) noexcept
+{
+    file_.reset();
+    source_ = std::move(source);
+    source_length_ = length;
+}
+
+//------------------------------------------------------------------------------
+bool RequestImpl::SetFile(string_view path) noexcept
+{
+    auto file = make_shared<MappedFile>(path);
+    if (!file->IsValid())
+    {
+        return false;
+    }
+
+    SetSource([file = file.get()](char *buffer, size_t size)
+              { return file->Read(buffer, size); },
+              static_cast<int64_t>(file->Size()));
+    file_ = std::move(file);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool RequestImpl::LoadBody() noexcept
+{
+    static constexpr size_t chunk_size{16384};
+    std::array<char, chunk_size> chunk{};
+
+    size_t size = data_->Read(chunk.data(), chunk.size());
+    if (size == 0)
+    {
+        // Данные не прочитаны: объект данных не изменялся после предыдущего
+        // переноса или данные заменены пустыми.
+        const size_t length = data_->Length();
+        if (length == body_length_)
+        {
+            return false;
+        }
+
+        body_.clear();
+        body_length_ = length;
+        return true;
+    }
+
+    body_.assign(chunk.data(), size);
+    while (size != 0)
+    {
+        const size_t offset = body_.size();
+        body_.resize(offset + chunk_size);
+        size = data_->Read(body_.data() + offset, chunk_size);
+        body_.resize(offset + size);
+    }
+
+    body_length_ = data_->Length();
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void RequestImpl::Compress(int64_t min_size, int level) noexcept
+{
+    body_offset_ = 0;
+
+    // Неизменные данные передаются в ранее подготовленном виде.
+    const bool changed = !source_ && LoadBody();
+    if (!changed && !(source_ && !compressed_.empty()))
+    {
+        return;
+    }
+
+    if (!compressed_.empty())
+    {
+        headers_->Set("Content-Encoding", "");
+        compressed_.clear();
+    }
+
+    // Данные, уже закодированные вызывающей стороной, не сжимаются повторно.
+    const auto length = static_cast<int64_t>(body_.size());
+    if (source_ || min_size <= 0 || length < min_size ||
+        !headers_->Get("Content-Encoding").empty())
+    {
+        return;
+    }
+
+    // Размер окна 15 и смещение 16 задают формат gzip.
+    static constexpr int gzip_window_bits{15 + 16};
+    static constexpr int memory_level{8};
+
+    z_stream stream{};
+    if (deflateInit2(&stream,
+                     level,
+                     Z_DEFLATED,
+                     gzip_window_bits,
+                     memory_level,
+                     Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        Logging::Error("Ошибка инициализации сжатия данных запроса");
+        return;
+    }
+
+    compressed_.resize(deflateBound(&stream, static_cast<uLong>(length)));
+    stream.next_out = reinterpret_cast<Bytef *>(compressed_.data());
+    stream.avail_out = static_cast<uInt>(compressed_.size());
+    stream.next_in = reinterpret_cast<Bytef *>(body_.data());
+    stream.avail_in = static_cast<uInt>(body_.size());
+
+    const int result = deflate(&stream, Z_FINISH);
+    compressed_.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    if (result != Z_STREAM_END)
+    {
+        Logging::Error("Ошибка сжатия данных запроса");
+        compressed_.clear();
+        return;
+    }
+
+    headers_->Set("Content-Encoding", "gzip");
+}
+
+//------------------------------------------------------------------------------
+int64_t RequestImpl::BodyLength() const noexcept
+{
+    if (source_)
+    {
+        return source_length_;
+    }
+
+    if (!compressed_.empty())
+    {
+        return static_cast<int64_t>(compressed_.size());
+    }
+
+    return static_cast<int64_t>(body_.size());
+}
+
+//------------------------------------------------------------------------------
+void RequestImpl::Rewind() noexcept
+{
+    body_offset_ = 0;
+
+    if (file_)
+    {
+        file_->Rewind();
+    }
+}
+
+//------------------------------------------------------------------------------
+bool RequestImpl::Rewindable() const noexcept
+{
+    return !source_ || file_ != nullptr;
+}
+
+//------------------------------------------------------------------------------
+void RequestImpl::ApplyHeader() noexcept
+{
+    headers_->Apply();
+}
+
 //------------------------------------------------------------------------------
 size_t RequestImpl::ReadDataCallback(char *buffer,
                                      size_t size,
@@ -83,7 +294,19 @@ size_t RequestImpl::ReadDataCallback(char *buffer,
                                      void *userdata) noexcept
 {
     auto *client = static_cast<RequestImpl *>(userdata);
-    return client->data_->Read(buffer, nitems * size);
+    if (client->source_)
+    {
+        return client->source_(buffer, nitems * size);
+    }
+
+    const string &body =
+        client->compressed_.empty() ? client->body_ : client->compressed_;
+    const size_t length =
+        std::min(nitems * size, body.size() - client->body_offset_);
+    std::memcpy(buffer, body.data() + client->body_offset_, length);
+    client->body_offset_ += length;
+
+    return length;
 }
 
 }  // namespace tasp::http
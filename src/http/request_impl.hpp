@@ -7,11 +7,18 @@
 
 #include <curl/curl.h>
 
+#include <functional>
+
 #include <tasp/http/data.hpp>
 #include <tasp/http/header.hpp>
 #include <tasp/http/request.hpp>
 #include <tasp/http/uri.hpp>
 
+#include "../service_config.hpp"
+#include "header_impl.hpp"
+#include "mapped_file.hpp"
+#include "uri_impl.hpp"
+
 namespace tasp::http
 {
 
@@ -21,6 +28,13 @@ namespace tasp::http
 class RequestImpl : public Request
 {
 public:
+    /**
+     * @brief Функция чтения очередного фрагмента данных запроса. Возвращает
+     * количество записанных в буфер байт, 0 по окончании данных или
+     * CURL_READFUNC_ABORT для прерывания запроса.
+     */
+    using Source = std::function<size_t(char *, size_t)>;
+
     /**
      * @brief Конструктор.
      *
@@ -37,14 +51,14 @@ public:
                          std::shared_ptr<CURL> curl) noexcept;
 
     /**
-     * @brief Конструктор с загрузкой данных из конфигурационного файла.
+     * @brief Конструктор по параметрам сервиса из конфигурационного файла.
      *
-     * @param config Путь в глобальном конфигурационном файле
+     * @param service Параметры сервиса
      * @param path Путь запроса
      * @param method Метод запроса
      * @param curl Указатель на главную структуру библиотеки CURL
      */
-    explicit RequestImpl(std::string_view config,
+    explicit RequestImpl(const ServiceConfig &service,
                          std::string_view path,
                          Request::Method method,
                          std::shared_ptr<CURL> curl) noexcept;
@@ -83,6 +97,106 @@ public:
      */
     [[nodiscard]] std::shared_ptr<http::Data> Data() const noexcept override;
 
+    /**
+     * @brief Смена метода запроса.
+     *
+     * @param method Метод запроса
+     */
+    void SetMethod(Request::Method method) noexcept;
+
+    /**
+     * @brief Сброс запроса для повторного использования: смена метода и пути,
+     * удаление параметров и данных запроса. Заголовок запроса сохраняется.
+     *
+     * @param path Путь запроса
+     * @param method Метод запроса
+     */
+    void Reset(std::string_view path, Request::Method method) noexcept;
+
+    /**
+     * @brief Установка строки параметров запроса.
+     *
+     * @param query Строка параметров в закодированном виде
+     */
+    void SetQuery(std::string_view query) noexcept;
+
+    /**
+     * @brief Направление запроса на узел сервиса.
+     *
+     * @param endpoint Узел сервиса
+     */
+    void SetEndpoint(const LoadBalancer::Endpoint &endpoint) noexcept;
+
+    /**
+     * @brief Формирование идентификатора ресурса на другом узле сервиса без
+     * изменения запроса.
+     *
+     * @param endpoint Узел сервиса
+     *
+     * @return Идентификатор ресурса
+     */
+    [[nodiscard]] std::string EndpointUrl(
+        const LoadBalancer::Endpoint &endpoint) const noexcept;
+
+    /**
+     * @brief Установка источника данных запроса вместо данных объекта запроса.
+     *
+     * @param source Функция чтения данных, пустая функция восстанавливает
+     * передачу данных объекта запроса
+     * @param length Размер данных в байтах, при отрицательном значении данные
+     * передаются по частям (chunked)
+     */
+    void SetSource(Source source, int64_t length) noexcept;
+
+    /**
+     * @brief Установка файла, отображаемого в память, в качестве источника
+     * данных запроса.
+     *
+     * @param path Путь к файлу
+     *
+     * @return Результат открытия файла
+     */
+    bool SetFile(std::string_view path) noexcept;
+
+    /**
+     * @brief Перенос данных объекта запроса в буфер запроса и сжатие данных
+     * (gzip) перед передачей с установкой заголовка Content-Encoding.
+     *
+     * Данные сжимаются целиком один раз после изменения, поэтому размер
+     * сжатых данных передается в заголовке Content-Length. Данные источника
+     * и данные с заголовком Content-Encoding (в любом регистре),
+     * установленным вызывающей стороной, не сжимаются.
+     *
+     * @param min_size Минимальный размер данных в байтах, 0 - данные не
+     * сжимаются
+     * @param level Уровень сжатия zlib
+     */
+    void Compress(int64_t min_size, int level) noexcept;
+
+    /**
+     * @brief Запрос размера передаваемых данных.
+     *
+     * @return Размер в байтах или -1, если размер неизвестен
+     */
+    [[nodiscard]] int64_t BodyLength() const noexcept;
+
+    /**
+     * @brief Подготовка источника данных к повторной передаче.
+     */
+    void Rewind() noexcept;
+
+    /**
+     * @brief Проверка возможности повторной передачи данных запроса.
+     *
+     * @return Признак передачи данных из буфера запроса или из файла
+     */
+    [[nodiscard]] bool Rewindable() const noexcept;
+
+    /**
+     * @brief Передача измененного заголовка запроса в библиотеку CURL.
+     */
+    void ApplyHeader() noexcept;
+
     /**
      * @brief Функция для записи данных запроса, для передачи в библиотеку CURL.
      *
@@ -104,6 +218,17 @@ public:
     RequestImpl &operator=(RequestImpl &&) = delete;
 
 private:
+    /**
+     * @brief Перенос данных объекта запроса в буфер запроса.
+     *
+     * Объект данных позволяет только последовательное чтение, поэтому данные
+     * переносятся в буфер один раз после изменения и передаются из буфера
+     * при каждой попытке и каждом выполнении запроса.
+     *
+     * @return Признак изменения данных
+     */
+    bool LoadBody() noexcept;
+
     /**
      * @brief Базовой конструктор.
      *
@@ -121,7 +246,7 @@ private:
     /**
      * @brief Указатель на ресурс.
      */
-    std::shared_ptr<http::Uri> uri_;
+    std::shared_ptr<UriImpl> uri_;
 
     /**
      * @brief Метод запроса.
@@ -131,12 +256,48 @@ private:
     /**
      * @brief Заголовок запроса.
      */
-    std::shared_ptr<http::Header> headers_;
+    std::shared_ptr<HeaderImpl> headers_;
 
     /**
      * @brief Данные запроса.
      */
     std::shared_ptr<http::Data> data_;
+
+    /**
+     * @brief Источник данных запроса.
+     */
+    Source source_;
+
+    /**
+     * @brief Размер данных источника.
+     */
+    int64_t source_length_{-1};
+
+    /**
+     * @brief Файл, используемый в качестве источника данных.
+     */
+    std::shared_ptr<MappedFile> file_;
+
+    /**
+     * @brief Данные объекта запроса, перенесенные для передачи.
+     */
+    std::string body_;
+
+    /**
+     * @brief Размер объекта данных при последнем переносе в буфер.
+     */
+    size_t body_length_{0};
+
+    /**
+     * @brief Количество переданных байт данных буфера.
+     */
+    size_t body_offset_{0};
+
+    /**
+     * @brief Сжатые данные буфера, пустая строка - данные передаются без
+     * сжатия и заголовок Content-Encoding не установлен библиотекой.
+     */
+    std::string compressed_;
 };
 
 }  // namespace tasp::http
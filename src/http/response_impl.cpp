@@ -1,5 +1,12 @@
 #include "response_impl.hpp"
 
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+
 #include <tasp/logging.hpp>
 
 using std::make_shared;
@@ -9,12 +16,25 @@ using std::string_view;
 
 namespace tasp::http
 {
+
+namespace
+{
+
+/**
+ * @brief Максимальный размер буфера данных ответа, выделяемого заранее по
+ * заголовку Content-Length, если размер данных не ограничен.
+ */
+constexpr size_t reserve_limit{16 * 1024 * 1024};
+
+}  // namespace
+
 /*------------------------------------------------------------------------------
     ResponseImpl
 ------------------------------------------------------------------------------*/
 ResponseImpl::ResponseImpl(const shared_ptr<CURL> &curl) noexcept
 : headers_(make_shared<HeaderImpl>(curl))
 , data_(make_shared<http::Data>())
+, curl_(curl)
 {
 }
 
@@ -52,6 +72,141 @@ void ResponseImpl::SetError(Code code, string_view message) noexcept
     Data()->Set(string(message.data(), message.size()));
 }
 
+//------------------------------------------------------------------------------
+void ResponseImpl::SetSink(Sink sink) noexcept
+{
+    sink_ = std::move(sink);
+}
+
+//------------------------------------------------------------------------------
+bool ResponseImpl::HasSink() const noexcept
+{
+    return static_cast<bool>(sink_.data);
+}
+
+//------------------------------------------------------------------------------
+Client::Sink ResponseImpl::FileSink(int fd) noexcept
+{
+    return [fd](string_view chunk)
+    {
+        while (!chunk.empty())
+        {
+            const ssize_t written = write(fd, chunk.data(), chunk.size());
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                Logging::Error("Ошибка записи данных HTTP-ответа: {}",
+                               std::strerror(errno));
+                return false;
+            }
+
+            chunk.remove_prefix(static_cast<size_t>(written));
+        }
+
+        return true;
+    };
+}
+
+//------------------------------------------------------------------------------
+void ResponseImpl::SetMaxSize(size_t size) noexcept
+{
+    max_size_ = size;
+}
+
+//------------------------------------------------------------------------------
+CURLcode ResponseImpl::Finish(CURLcode result) noexcept
+{
+    if (sink_.data)
+    {
+        if (!sink_.end)
+        {
+            return result;
+        }
+
+        // Неполные данные не обрабатываются как окончание ответа.
+        if (result != CURLcode::CURLE_OK)
+        {
+            sink_.end(Client::SinkStatus::Aborted);
+            return result;
+        }
+
+        return sink_.end(Client::SinkStatus::Complete)
+                   ? result
+                   : CURLcode::CURLE_WRITE_ERROR;
+    }
+
+    if (!body_.empty())
+    {
+        data_->Set(std::move(body_));
+        body_ = string();
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+void ResponseImpl::CollectTiming(CURL *curl) noexcept
+{
+    auto time = [curl](CURLINFO info)
+    {
+        curl_off_t value{0};
+        curl_easy_getinfo(curl, info, &value);
+        return std::chrono::microseconds(value);
+    };
+
+    auto size = [curl](CURLINFO info)
+    {
+        curl_off_t value{0};
+        curl_easy_getinfo(curl, info, &value);
+        return static_cast<uint64_t>(value);
+    };
+
+    timing_.name_lookup = time(CURLINFO_NAMELOOKUP_TIME_T);
+    timing_.connect = time(CURLINFO_CONNECT_TIME_T);
+    timing_.tls_handshake = time(CURLINFO_APPCONNECT_TIME_T);
+    timing_.pre_transfer = time(CURLINFO_PRETRANSFER_TIME_T);
+    timing_.first_byte = time(CURLINFO_STARTTRANSFER_TIME_T);
+    timing_.total = time(CURLINFO_TOTAL_TIME_T);
+
+    timing_.bytes_sent = size(CURLINFO_SIZE_UPLOAD_T);
+    timing_.bytes_received = size(CURLINFO_SIZE_DOWNLOAD_T);
+
+    // NOLINTNEXTLINE(google-runtime-int)
+    long connects{0};
+    curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &connects);
+
+    // Запрос без новых соединений не использовал соединение вовсе, если
+    // адрес узла не определен (ошибка разрешения имени или соединения).
+    char *primary_ip{nullptr};
+    curl_easy_getinfo(curl, CURLINFO_PRIMARY_IP, &primary_ip);
+    timing_.connection_reused =
+        connects == 0 && primary_ip != nullptr && *primary_ip != '\0';
+}
+
+//------------------------------------------------------------------------------
+const Timing &ResponseImpl::GetTiming() const noexcept
+{
+    return timing_;
+}
+
+//------------------------------------------------------------------------------
+void ResponseImpl::SetResult(CURLcode result) noexcept
+{
+    const bool exceeded = max_size_ != 0 && received_ > max_size_;
+    result_ = result == CURLE_WRITE_ERROR && exceeded ? CURLE_FILESIZE_EXCEEDED
+                                                      : result;
+}
+
+//------------------------------------------------------------------------------
+CURLcode ResponseImpl::GetResult() const noexcept
+{
+    return result_;
+}
+
 //------------------------------------------------------------------------------
 size_t ResponseImpl::WriteDataCallback(char *buffer,
                                        size_t size,
@@ -59,9 +214,51 @@ size_t ResponseImpl::WriteDataCallback(char *buffer,
                                        void *userdata) noexcept
 {
     auto *response = static_cast<ResponseImpl *>(userdata);
-    response->data_->Append(buffer, nitems * size);
+    const size_t length{nitems * size};
+
+    if (response->received_ == 0 && !response->sink_.data && response->curl_)
+    {
+        curl_off_t content_length{-1};
+        curl_easy_getinfo(response->curl_.get(),
+                          CURLINFO_CONTENT_LENGTH_DOWNLOAD_T,
+                          &content_length);
+        // Размер из заголовка - только оценка (при сжатии данных это размер
+        // сжатых данных), поэтому заранее выделяется не больше reserve_limit.
+        const auto expected = static_cast<size_t>(std::max<curl_off_t>(
+            content_length, 0));
+        if (expected != 0 &&
+            (response->max_size_ == 0 || expected <= response->max_size_))
+        {
+            try
+            {
+                response->body_.reserve(std::min(expected, reserve_limit));
+            }
+            catch (const std::bad_alloc &)
+            {
+                // Буфер увеличивается по мере приема данных.
+            }
+        }
+    }
+
+    response->received_ += length;
+    if (response->max_size_ != 0 && response->received_ > response->max_size_)
+    {
+        Logging::Error("Размер данных HTTP-ответа превышает {} байт",
+                       response->max_size_);
+        return 0;
+    }
+
+    // Библиотека CURL может передать пустой фрагмент при пустых данных.
+    if (response->sink_.data)
+    {
+        return length == 0 || response->sink_.data(string_view(buffer, length))
+                   ? length
+                   : 0;
+    }
+
+    response->body_.append(buffer, length);
 
-    return nitems * size;
+    return length;
 }
 
 }  // namespace tasp::http
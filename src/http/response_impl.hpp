@@ -5,7 +5,12 @@
 #ifndef TASP_HTTP_RESPONSE_IMPL_HPP_
 #define TASP_HTTP_RESPONSE_IMPL_HPP_
 
+#include <functional>
+#include <string_view>
+
+#include <tasp/http/client.hpp>
 #include <tasp/http/response.hpp>
+#include <tasp/http/timing.hpp>
 
 #include "header_impl.hpp"
 
@@ -18,6 +23,22 @@ namespace tasp::http
 class ResponseImpl : public Response
 {
 public:
+    /**
+     * @brief Функции приема данных ответа.
+     */
+    struct Sink
+    {
+        /**
+         * @brief Функция приема фрагментов данных ответа.
+         */
+        Client::Sink data;
+
+        /**
+         * @brief Функция, вызываемая по окончании попытки выполнения запроса.
+         */
+        Client::SinkEnd end;
+    };
+
     /**
      * @brief Конструктор.
      *
@@ -67,6 +88,80 @@ public:
      */
     void SetError(Code code, std::string_view message) noexcept override;
 
+    /**
+     * @brief Установка функций приема данных ответа. При установленной
+     * функции приема фрагментов данные ответа не сохраняются в объекте ответа.
+     *
+     * @param sink Функции приема данных ответа
+     */
+    void SetSink(Sink sink) noexcept;
+
+    /**
+     * @brief Проверка установки функции приема данных ответа.
+     *
+     * @return Признак установки функции
+     */
+    [[nodiscard]] bool HasSink() const noexcept;
+
+    /**
+     * @brief Формирование функции приема данных ответа с записью в файловый
+     * дескриптор.
+     *
+     * @param fd Файловый дескриптор, открытый на запись
+     *
+     * @return Функция приема фрагментов данных ответа
+     */
+    [[nodiscard]] static Client::Sink FileSink(int fd) noexcept;
+
+    /**
+     * @brief Установка максимального размера данных ответа. При превышении
+     * выполнение запроса прерывается.
+     *
+     * @param size Размер в байтах, 0 - без ограничения
+     */
+    void SetMaxSize(size_t size) noexcept;
+
+    /**
+     * @brief Завершение приема данных и их передача в объект данных ответа
+     * или вызов функции окончания попытки.
+     *
+     * @param result Результат выполнения запроса библиотекой CURL
+     *
+     * @return Результат выполнения запроса, CURLE_WRITE_ERROR - функция
+     * приема отклонила окончание данных
+     */
+    [[nodiscard]] CURLcode Finish(CURLcode result) noexcept;
+
+    /**
+     * @brief Заполнение временных характеристик по данным библиотеки CURL.
+     *
+     * @param curl Указатель на главную структуру библиотеки CURL
+     */
+    void CollectTiming(CURL *curl) noexcept;
+
+    /**
+     * @brief Запрос временных характеристик выполнения запроса.
+     *
+     * @return Временные характеристики
+     */
+    [[nodiscard]] const Timing &GetTiming() const noexcept;
+
+    /**
+     * @brief Установка результата выполнения запроса. Прерывание приема
+     * данных при превышении максимального размера ответа сохраняется как
+     * CURLE_FILESIZE_EXCEEDED.
+     *
+     * @param result Результат выполнения запроса библиотекой CURL
+     */
+    void SetResult(CURLcode result) noexcept;
+
+    /**
+     * @brief Запрос результата выполнения запроса.
+     *
+     * @return Результат выполнения запроса библиотекой CURL
+     */
+    [[nodiscard]] CURLcode GetResult() const noexcept;
+
     /**
      * @brief Функция для чтения данных ответа, для передачи в библиотеку CURL.
      *
@@ -102,6 +197,42 @@ private:
      * @brief Данные ответа.
      */
     std::shared_ptr<http::Data> data_;
+
+    /**
+     * @brief Функции приема данных ответа.
+     */
+    Sink sink_;
+
+    /**
+     * @brief Указатель на главную структуру библиотеки CURL.
+     */
+    std::shared_ptr<CURL> curl_;
+
+    /**
+     * @brief Буфер данных ответа, размер которого выделяется один раз по
+     * заголовку Content-Length, но не больше 16 МиБ.
+     */
+    std::string body_;
+
+    /**
+     * @brief Количество принятых байт данных ответа.
+     */
+    size_t received_{0};
+
+    /**
+     * @brief Максимальный размер данных ответа.
+     */
+    size_t max_size_{0};
+
+    /**
+     * @brief Временные характеристики выполнения запроса.
+     */
+    Timing timing_;
+
+    /**
+     * @brief Результат выполнения запроса библиотекой CURL.
+     */
+    CURLcode result_{CURLE_OK};
 };
 
 }  // namespace tasp::http
@@ -1,15 +1,90 @@
 #include "uri_impl.hpp"
 
-#include <tasp/config.hpp>
+#include <algorithm>
+#include <array>
+#include <charconv>
+
 #include <tasp/logging.hpp>
 
+#include "pattern_cache.hpp"
+
 using std::shared_ptr;
 using std::string;
 using std::string_view;
 using std::to_string;
+using std::vector;
 
 namespace tasp::http
 {
+
+namespace
+{
+
+/**
+ * @brief Установка схемы, хоста и порта узла сервиса в структуру URL.
+ *
+ * @param url Указатель на структуру URL библиотеки CURL
+ * @param endpoint Узел сервиса
+ */
+void SetOrigin(CURLU *url, const LoadBalancer::Endpoint &endpoint) noexcept
+{
+    curl_url_set(url, CURLUPART_SCHEME, endpoint.schema.c_str(), 0);
+    curl_url_set(url, CURLUPART_HOST, endpoint.host.c_str(), 0);
+    curl_url_set(url,
+                 CURLUPART_PORT,
+                 endpoint.port.empty() ? nullptr : endpoint.port.c_str(),
+                 0);
+}
+
+/**
+ * @brief Проверка допустимости названия параметра в SQL-условии: буквы
+ * латинского алфавита, цифры, _ и ., первый символ не цифра.
+ *
+ * @param name Название параметра
+ *
+ * @return Признак допустимости
+ */
+bool IsSQLName(string_view name) noexcept
+{
+    if (name.empty() || (name.front() >= '0' && name.front() <= '9'))
+    {
+        return false;
+    }
+
+    return std::all_of(name.begin(),
+                       name.end(),
+                       [](char c)
+                       {
+                           return (c >= 'a' && c <= 'z') ||
+                                  (c >= 'A' && c <= 'Z') ||
+                                  (c >= '0' && c <= '9') || c == '_' ||
+                                  c == '.';
+                       });
+}
+
+/**
+ * @brief Добавление строкового литерала SQL с удвоением кавычек.
+ *
+ * @param sql Буфер условия
+ * @param value Значение без обратной косой черты и нулевого символа
+ */
+void AppendSQLString(string &sql, string_view value) noexcept
+{
+    sql.push_back('\'');
+
+    for (auto special = value.find('\'');
+         special != string_view::npos;
+         special = value.find('\''))
+    {
+        sql.append(value.data(), special + 1).push_back(value[special]);
+        value.remove_prefix(special + 1);
+    }
+
+    sql.append(value).push_back('\'');
+}
+
+}  // namespace
+
 /*------------------------------------------------------------------------------
     UriImpl
 ------------------------------------------------------------------------------*/
@@ -28,39 +103,21 @@ UriImpl::UriImpl(string_view host,
 }
 
 //------------------------------------------------------------------------------
-UriImpl::UriImpl(string_view config,
+UriImpl::UriImpl(const ServiceConfig &service,
                  string_view path,
                  shared_ptr<CURL> curl) noexcept
 : curl_(std::move(curl))
-, curl_url_(curl_url())
+, curl_url_(service.url ? curl_url_dup(service.url.get()) : curl_url())
+, prefix_(service.prefix)
 , path_(path)
 {
-    string service{"services."};
-    service.append(config.data()).append(".");
-
-    const string format_pattern{"{}"};
-    string uri{"{}://{}:{}"};
-
-    auto &config_file = ConfigGlobal::Instance();
-
-    auto replace = [&](string_view param, string_view default_value)
+    if (!service.url)
     {
-        auto value = config_file.Get<string>(service + param.data(),
-                                             default_value.data());
-        auto pos = uri.find(format_pattern);
-        if (pos != string::npos)
-        {
-            uri.replace(pos, format_pattern.length(), value);
-        }
-    };
-
-    replace("schema", "http");
-    replace("host", "127.0.0.1");
-    replace("port", "80");
-
-    prefix_ = config_file.Get<string>(service + "prefix", "/api/v1");
+        Init(service.Origin());
+        return;
+    }
 
-    Init(uri);
+    UriImpl::ChangePath(path_);
 }
 
 //------------------------------------------------------------------------------
@@ -95,10 +152,58 @@ const string &UriImpl::Path() const noexcept
 //------------------------------------------------------------------------------
 void UriImpl::ChangePath(std::string_view path) noexcept
 {
-    path_ = prefix_ + path.data();
+    string full_path{prefix_};
+    full_path.append(path);
+    path_ = std::move(full_path);
+
     curl_url_set(
         curl_url_.get(), CURLUPART_PATH, path_.c_str(), CURLU_DEFAULT_SCHEME);
 
+    UpdateUrl();
+}
+
+//------------------------------------------------------------------------------
+void UriImpl::SetQuery(string_view query) noexcept
+{
+    const string value{query};
+    curl_url_set(curl_url_.get(),
+                 CURLUPART_QUERY,
+                 value.empty() ? nullptr : value.c_str(),
+                 0);
+
+    UpdateUrl();
+}
+
+//------------------------------------------------------------------------------
+void UriImpl::SetEndpoint(const LoadBalancer::Endpoint &endpoint) noexcept
+{
+    SetOrigin(curl_url_.get(), endpoint);
+
+    UpdateUrl();
+}
+
+//------------------------------------------------------------------------------
+string UriImpl::EndpointUrl(
+    const LoadBalancer::Endpoint &endpoint) const noexcept
+{
+    const CurlURL url(curl_url_dup(curl_url_.get()));
+    SetOrigin(url.get(), endpoint);
+
+    string result;
+
+    char *value{nullptr};
+    if (curl_url_get(url.get(), CURLUPART_URL, &value, 0) == CURLUE_OK)
+    {
+        result = value;
+    }
+    curl_free(value);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+void UriImpl::UpdateUrl() noexcept
+{
     char *value{nullptr};
 
     const CURLUcode code =
@@ -110,32 +215,253 @@ void UriImpl::ChangePath(std::string_view path) noexcept
     curl_free(value);
 
     curl_easy_setopt(curl_.get(), CURLOPT_URL, url_.c_str());
+
+    query_parsed_ = false;
 }
 
 //------------------------------------------------------------------------------
-url::ParamValueVector UriImpl::ParamValues(
-    [[maybe_unused]] string_view name) const noexcept
+const QueryParams &UriImpl::Params() const noexcept
 {
-    return {};
+    if (query_parsed_)
+    {
+        return query_params_;
+    }
+
+    query_params_.clear();
+
+    string_view query{url_};
+    const auto begin = query.find('?');
+    if (begin != string_view::npos)
+    {
+        query = query.substr(begin + 1);
+        ParseQuery(query.substr(0, query.find('#')), query_params_);
+    }
+
+    query_parsed_ = true;
+    return query_params_;
 }
 
 //------------------------------------------------------------------------------
-bool UriImpl::Match([[maybe_unused]] string_view expr) noexcept
+url::ParamValueVector UriImpl::ParamValues(string_view name) const noexcept
 {
-    return false;
+    const auto &params = Params();
+    const auto [begin, end] = params.equal_range(name);
+
+    if (begin == end)
+    {
+        return {};
+    }
+
+    if (std::next(begin) == end)
+    {
+        return begin->second;
+    }
+
+    url::ParamValueVector values;
+    for (auto param = begin; param != end; ++param)
+    {
+        values.insert(
+            values.end(), param->second.begin(), param->second.end());
+    }
+
+    return values;
+}
+
+//------------------------------------------------------------------------------
+bool UriImpl::Match(string_view expr) noexcept
+{
+    sub_match_count_ = 0;
+
+    const auto pattern = PatternCache::Instance().Get(expr);
+    if (!pattern)
+    {
+        return false;
+    }
+
+    // При сложном выражении и длинном пути сравнение может превысить
+    // ограничения библиотеки (error_complexity, error_stack). Путь задается
+    // клиентом, поэтому ошибка записывается один раз для выражения.
+    try
+    {
+        if (!std::regex_match(path_, match_, *pattern))
+        {
+            return false;
+        }
+    }
+    catch (const std::regex_error &error)
+    {
+        if (PatternCache::Instance().MatchFailed(expr))
+        {
+            Logging::Error("Ошибка сравнения пути {} с регулярным "
+                           "выражением {}: {}",
+                           path_,
+                           expr,
+                           error.what());
+        }
+        return false;
+    }
+
+    // Строки подгрупп перезаписываются на месте, чтобы сохранить выделенную
+    // память.
+    sub_match_count_ = match_.size();
+    if (sub_matches_.size() < sub_match_count_)
+    {
+        sub_matches_.resize(sub_match_count_);
+    }
+
+    for (size_t i = 0; i < sub_match_count_; ++i)
+    {
+        const auto &sub_match = match_[i];
+        if (sub_match.matched)
+        {
+            sub_matches_[i].assign(sub_match.first, sub_match.second);
+        }
+        else
+        {
+            sub_matches_[i].clear();
+        }
+    }
+
+    return true;
 }
 
 //------------------------------------------------------------------------------
-const string &UriImpl::SubMatch([[maybe_unused]] size_t number) const noexcept
+const string &UriImpl::SubMatch(size_t number) const noexcept
 {
     static const string empty_value;
-    return empty_value;
+
+    if (number >= sub_match_count_)
+    {
+        return empty_value;
+    }
+
+    return sub_matches_[number];
+}
+
+//------------------------------------------------------------------------------
+string UriImpl::ToSQLCondition() const noexcept
+{
+    string sql;
+    AppendSQLCondition(sql, nullptr, SQLCondition::Placeholder::Numbered);
+
+    return sql;
 }
 
 //------------------------------------------------------------------------------
-std::string UriImpl::ToSQLCondition() const noexcept
+SQLCondition UriImpl::ToSQLCondition(
+    SQLCondition::Placeholder placeholder) const noexcept
 {
-    return {};
+    SQLCondition condition;
+    AppendSQLCondition(condition.sql, &condition.values, placeholder);
+
+    return condition;
+}
+
+//------------------------------------------------------------------------------
+void UriImpl::AppendSQLCondition(string &sql,
+                                 vector<string> *values,
+                                 SQLCondition::Placeholder placeholder) const
+    noexcept
+{
+    // Оценка сверху: разделитель " AND ", " IN ()" и для каждого значения
+    // литерал с удвоенными спецсимволами или метка подстановки. Параметры
+    // перебираются по названию, вхождения одного параметра - в порядке
+    // строки параметров, поэтому условие не зависит от порядка параметров.
+    static constexpr size_t condition_size{11};
+    static constexpr size_t placeholder_size{16};
+    static constexpr string_view false_condition{"1 = 0"};
+    static constexpr string_view unsafe_symbols{"\0\\", 2};
+
+    const auto &params = Params();
+
+    size_t size{0};
+    size_t count{0};
+    for (const auto &[name, param_values] : params)
+    {
+        size += name.size() + condition_size;
+        for (const auto &value : param_values)
+        {
+            size += values != nullptr ? placeholder_size
+                                      : value.size() * 2 + 4;
+        }
+        count += param_values.size();
+    }
+
+    sql.reserve(size);
+    if (values != nullptr)
+    {
+        values->reserve(count);
+    }
+
+    for (const auto &[name, param_values] : params)
+    {
+        if (param_values.empty())
+        {
+            continue;
+        }
+
+        if (!IsSQLName(name))
+        {
+            Logging::Error(
+                "Недопустимое название параметра для SQL-условия: {}", name);
+            continue;
+        }
+
+        if (!sql.empty())
+        {
+            sql.append(" AND ");
+        }
+
+        const bool single = param_values.size() == 1;
+        sql.append(name).append(single ? " = " : " IN (");
+
+        bool first{true};
+        for (const auto &value : param_values)
+        {
+            if (!first)
+            {
+                sql.append(", ");
+            }
+            first = false;
+
+            if (values == nullptr)
+            {
+                // Нулевой символ и обратная косая черта (символ
+                // экранирования только в части СУБД) не могут быть одинаково
+                // переданы в литерале для всех СУБД, условие заменяется
+                // ложным, а не пропускается.
+                if (value.find_first_of(unsafe_symbols) != string::npos)
+                {
+                    Logging::Error("Недопустимый символ в значении параметра "
+                                   "{} SQL-условия",
+                                   name);
+                    sql.assign(false_condition);
+                    return;
+                }
+
+                AppendSQLString(sql, value);
+                continue;
+            }
+
+            values->push_back(value);
+
+            if (placeholder == SQLCondition::Placeholder::Question)
+            {
+                sql.push_back('?');
+                continue;
+            }
+
+            std::array<char, placeholder_size> number{};
+            const auto result = std::to_chars(
+                number.data(), number.data() + number.size(), values->size());
+            sql.append("$").append(number.data(), result.ptr);
+        }
+
+        if (!single)
+        {
+            sql.push_back(')');
+        }
+    }
 }
 
 }  // namespace tasp::http
@@ -8,10 +8,16 @@
 #include <curl/curl.h>
 
 #include <memory>
-#include <unordered_map>
+#include <regex>
+#include <string>
+#include <vector>
 
+#include <tasp/http/sql.hpp>
 #include <tasp/http/uri.hpp>
 
+#include "../service_config.hpp"
+#include "query_parser.hpp"
+
 namespace tasp::http
 {
 
@@ -56,13 +62,13 @@ public:
                      std::shared_ptr<CURL> curl) noexcept;
 
     /**
-     * @brief Конструктор с загрузкой данных из конфигурационного файла.
+     * @brief Конструктор по параметрам сервиса из конфигурационного файла.
      *
-     * @param config Путь в глобальном конфигурационном файле
+     * @param service Параметры сервиса
      * @param path Путь запроса
      * @param curl Указатель на главную структуру библиотеки CURL
      */
-    explicit UriImpl(std::string_view config,
+    explicit UriImpl(const ServiceConfig &service,
                      std::string_view path,
                      std::shared_ptr<CURL> curl) noexcept;
 
@@ -93,11 +99,38 @@ public:
     void ChangePath(std::string_view path) noexcept override;
 
     /**
-     * @brief Запрос значений параметра.
+     * @brief Установка строки параметров запроса.
+     *
+     * @param query Строка параметров в закодированном виде без символа ?,
+     * пустая строка удаляет параметры
+     */
+    void SetQuery(std::string_view query) noexcept;
+
+    /**
+     * @brief Замена схемы, хоста и порта на параметры узла сервиса.
+     *
+     * @param endpoint Узел сервиса
+     */
+    void SetEndpoint(const LoadBalancer::Endpoint &endpoint) noexcept;
+
+    /**
+     * @brief Формирование идентификатора ресурса на узле сервиса без
+     * изменения URI.
+     *
+     * @param endpoint Узел сервиса
+     *
+     * @return Идентификатор ресурса
+     */
+    [[nodiscard]] std::string EndpointUrl(
+        const LoadBalancer::Endpoint &endpoint) const noexcept;
+
+    /**
+     * @brief Запрос значений параметра. Строка параметров разбирается при
+     * первом обращении после ее изменения.
      *
      * @param name Название параметра
      *
-     * @return Массив значений, переданных в URL
+     * @return Массив значений, переданных в URL, для всех вхождений параметра
      */
     [[nodiscard]] url::ParamValueVector ParamValues(
         std::string_view name) const noexcept override;
@@ -106,6 +139,9 @@ public:
      * @brief Проверка соответствия URL-пути регулярному выражению и
      * формирование подгрупп пути.
      *
+     * Выражение компилируется один раз и хранится в общем для процесса кэше,
+     * память для подгрупп повторно используется при следующих вызовах.
+     *
      * @param expr Регулярное выражение
      *
      * @return Результат сравнения
@@ -116,7 +152,7 @@ public:
      * @brief Запрос значения подгруппы пути. Если подгруппа отсутствует,
      * возвращается пустое значение.
      *
-     * @param number Номер подгруппы
+     * @param number Номер подгруппы, 0 - весь путь
      *
      * @return Значение подгруппы
      */
@@ -127,10 +163,28 @@ public:
      * @brief Преобразование параметров запроса в SQL-условие (для конкатенации
      * с 'WHERE').
      *
+     * Значения подставляются в условие строковыми литералами с удвоением
+     * кавычек. Обратная косая черта в одних СУБД является символом
+     * экранирования (MySQL), в других - обычным символом (PostgreSQL), поэтому
+     * при обратной косой черте или нулевом символе в значении возвращается
+     * ложное условие 1 = 0. Для сравнения любых значений используется
+     * ToSQLCondition(placeholder) с передачей значений отдельно.
+     *
      * @return SQL-условие.
      */
     [[nodiscard]] std::string ToSQLCondition() const noexcept override;
 
+    /**
+     * @brief Преобразование параметров запроса в SQL-условие с метками
+     * подстановки значений.
+     *
+     * @param placeholder Формат метки подстановки
+     *
+     * @return SQL-условие и значения для подстановки
+     */
+    [[nodiscard]] SQLCondition ToSQLCondition(
+        SQLCondition::Placeholder placeholder) const noexcept;
+
     UriImpl(const UriImpl &) = delete;
     UriImpl(UriImpl &&) = delete;
     UriImpl &operator=(const UriImpl &) = delete;
@@ -144,6 +198,34 @@ private:
      */
     void Init(std::string_view uri) noexcept;
 
+    /**
+     * @brief Формирование полного идентификатора ресурса и его передача в
+     * библиотеку CURL.
+     */
+    void UpdateUrl() noexcept;
+
+    /**
+     * @brief Запрос параметров запроса с разбором строки параметров при
+     * первом обращении.
+     *
+     * @return Параметры запроса
+     */
+    [[nodiscard]] const QueryParams &Params() const noexcept;
+
+    /**
+     * @brief Формирование SQL-условия в буфере, выделяемом один раз по
+     * оценке размера условия.
+     *
+     * @param sql Буфер условия
+     * @param values Значения для подстановки, nullptr - значения
+     * подставляются в условие литералами
+     * @param placeholder Формат метки подстановки
+     */
+    void AppendSQLCondition(std::string &sql,
+                            std::vector<std::string> *values,
+                            SQLCondition::Placeholder placeholder) const
+        noexcept;
+
     /**
      * @brief Указатель на главную структуру библиотеки CURL.
      */
@@ -162,7 +244,12 @@ private:
     /**
      * @brief Параметры запроса.
      */
-    std::unordered_multimap<std::string, url::ParamValueVector> query_params_;
+    mutable QueryParams query_params_;
+
+    /**
+     * @brief Признак соответствия параметров запроса строке параметров.
+     */
+    mutable bool query_parsed_{false};
 
     /**
      * @brief Префикс пути запроса.
@@ -173,6 +260,21 @@ private:
      * @brief URL-путь запроса.
      */
     std::string path_{"/"};
+
+    /**
+     * @brief Результат последнего сравнения пути с регулярным выражением.
+     */
+    std::smatch match_;
+
+    /**
+     * @brief Значения подгрупп пути последнего сравнения.
+     */
+    std::vector<std::string> sub_matches_;
+
+    /**
+     * @brief Количество подгрупп пути последнего сравнения.
+     */
+    size_t sub_match_count_{0};
 };
 
 }  // namespace tasp::http
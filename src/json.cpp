@@ -0,0 +1,52 @@
+#include "tasp/http/json.hpp"
+
+#include "http/json_splitter.hpp"
+
+using std::make_shared;
+using std::string_view;
+
+namespace tasp::http
+{
+
+namespace
+{
+
+/**
+ * @brief Формирование функций приема данных ответа с разделением данных на
+ * значения JSON.
+ *
+ * @param mode Формат данных
+ * @param handler Функция обработки значений
+ * @param max_size Максимальный размер значения в байтах
+ *
+ * @return Функции приема данных ответа
+ */
+JsonSink MakeSink(JsonSplitter::Mode mode,
+                  JsonHandler handler,
+                  size_t max_size) noexcept
+{
+    auto splitter =
+        make_shared<JsonSplitter>(mode, std::move(handler), max_size);
+
+    return {[splitter](string_view chunk) { return splitter->Write(chunk); },
+            [splitter](Client::SinkStatus status)
+            { return splitter->End(status); }};
+}
+
+}  // namespace
+
+/*------------------------------------------------------------------------------
+    JSON
+------------------------------------------------------------------------------*/
+JsonSink JsonLinesSink(JsonHandler handler, size_t max_size) noexcept
+{
+    return MakeSink(JsonSplitter::Mode::Lines, std::move(handler), max_size);
+}
+
+//------------------------------------------------------------------------------
+JsonSink JsonArraySink(JsonHandler handler, size_t max_size) noexcept
+{
+    return MakeSink(JsonSplitter::Mode::Array, std::move(handler), max_size);
+}
+
+}  // namespace tasp::http
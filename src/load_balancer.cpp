@@ -0,0 +1,333 @@
+#include "load_balancer.hpp"
+
+#include <algorithm>
+#include <random>
+
+#include <tasp/config.hpp>
+#include <tasp/logging.hpp>
+
+using std::make_shared;
+using std::make_unique;
+using std::shared_ptr;
+using std::string;
+using std::string_view;
+using std::unique_ptr;
+using std::vector;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+namespace tasp::http
+{
+
+namespace
+{
+
+/**
+ * @brief Удаление пробельных символов в начале и конце строки.
+ *
+ * @param value Строка
+ *
+ * @return Строка без пробельных символов
+ */
+string_view Trim(string_view value) noexcept
+{
+    const auto begin = value.find_first_not_of(" \t");
+    if (begin == string_view::npos)
+    {
+        return {};
+    }
+
+    const auto end = value.find_last_not_of(" \t");
+    return value.substr(begin, end - begin + 1);
+}
+
+/**
+ * @brief Разбор узла сервиса в формате [schema://]host[:port].
+ *
+ * @param value Описание узла
+ * @param schema Схема по умолчанию
+ * @param port Порт по умолчанию
+ *
+ * @return Узел сервиса
+ */
+unique_ptr<LoadBalancer::Endpoint> ParseEndpoint(string_view value,
+                                                 string_view schema,
+                                                 string_view port) noexcept
+{
+    auto endpoint = make_unique<LoadBalancer::Endpoint>();
+    endpoint->schema = schema;
+    endpoint->port = port;
+
+    const auto separator = value.find("://");
+    if (separator != string_view::npos)
+    {
+        endpoint->schema = value.substr(0, separator);
+        value.remove_prefix(separator + 3);
+    }
+
+    // Адрес IPv6 записывается в квадратных скобках: [::1]:8080.
+    const auto host_end = value.empty() || value.front() != '['
+                              ? value.rfind(':')
+                              : value.find("]:");
+    if (host_end == string_view::npos)
+    {
+        endpoint->host = value;
+    }
+    else
+    {
+        const auto port_begin = value.find(':', host_end);
+        endpoint->host = value.substr(0, port_begin);
+        endpoint->port = value.substr(port_begin + 1);
+    }
+
+    return endpoint;
+}
+
+/**
+ * @brief Преобразование стратегии выбора узла из конфигурационного файла.
+ *
+ * @param strategy Название стратегии
+ *
+ * @return Стратегия
+ */
+LoadBalancer::Strategy ParseStrategy(string_view strategy) noexcept
+{
+    if (strategy == "least_outstanding")
+    {
+        return LoadBalancer::Strategy::LeastOutstanding;
+    }
+    if (strategy == "power_of_two")
+    {
+        return LoadBalancer::Strategy::PowerOfTwo;
+    }
+
+    if (!strategy.empty() && strategy != "round_robin")
+    {
+        Logging::Error("Неизвестная стратегия распределения запросов: {}",
+                       strategy);
+    }
+
+    return LoadBalancer::Strategy::RoundRobin;
+}
+
+}  // namespace
+
+/*------------------------------------------------------------------------------
+    LoadBalancer
+------------------------------------------------------------------------------*/
+shared_ptr<LoadBalancer> LoadBalancer::Load(const string &section,
+                                            string_view schema,
+                                            string_view port) noexcept
+{
+    auto &config_file = ConfigGlobal::Instance();
+
+    const auto list = config_file.Get<string>(section + "endpoints", string());
+
+    vector<unique_ptr<Endpoint>> endpoints;
+    for (size_t begin = 0; begin <= list.size();)
+    {
+        auto end = list.find(',', begin);
+        if (end == string::npos)
+        {
+            end = list.size();
+        }
+
+        const auto value = Trim(string_view(list).substr(begin, end - begin));
+        if (!value.empty())
+        {
+            endpoints.push_back(ParseEndpoint(value, schema, port));
+        }
+
+        begin = end + 1;
+    }
+
+    if (endpoints.empty())
+    {
+        return nullptr;
+    }
+
+    auto balancer = make_shared<LoadBalancer>(
+        std::move(endpoints),
+        ParseStrategy(
+            config_file.Get<string>(section + "balancer", string())));
+
+    balancer->ejection_failures_ =
+        std::max(config_file.Get<int>(section + "ejection.failures",
+                                      balancer->ejection_failures_),
+                 0);
+    balancer->ejection_time_ = milliseconds{config_file.Get<int>(
+        section + "ejection.time",
+        static_cast<int>(balancer->ejection_time_.count()))};
+    balancer->ejection_max_percent_ =
+        std::clamp(config_file.Get<int>(section + "ejection.max_percent",
+                                        balancer->ejection_max_percent_),
+                   0,
+                   100);
+
+    return balancer;
+}
+
+//------------------------------------------------------------------------------
+LoadBalancer::LoadBalancer(vector<unique_ptr<Endpoint>> endpoints,
+                           Strategy strategy) noexcept
+: endpoints_(std::move(endpoints))
+, strategy_(strategy)
+{
+}
+
+//------------------------------------------------------------------------------
+LoadBalancer::~LoadBalancer() noexcept = default;
+
+//------------------------------------------------------------------------------
+LoadBalancer::Endpoint *LoadBalancer::Acquire(const Endpoint *exclude) noexcept
+{
+    const auto now = steady_clock::now().time_since_epoch().count();
+
+    // Если подходящих узлов нет, последовательно снимаются ограничения:
+    // сначала исключение по ошибкам, затем исключение узла.
+    for (int pass = 0; pass < 3; ++pass)
+    {
+        Endpoint *endpoint = Select(exclude, now, pass);
+        if (endpoint != nullptr)
+        {
+            endpoint->outstanding.fetch_add(1, std::memory_order_relaxed);
+            return endpoint;
+        }
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------
+void LoadBalancer::Release(Endpoint *endpoint) noexcept
+{
+    endpoint->outstanding.fetch_sub(1, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void LoadBalancer::Report(Endpoint *endpoint, bool failure) noexcept
+{
+    Release(endpoint);
+
+    if (!failure)
+    {
+        endpoint->failures.store(0, std::memory_order_relaxed);
+        return;
+    }
+
+    const int failures =
+        endpoint->failures.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (ejection_failures_ == 0 || failures < ejection_failures_)
+    {
+        return;
+    }
+
+    const auto now = steady_clock::now().time_since_epoch().count();
+
+    const auto ejected = std::count_if(
+        endpoints_.begin(),
+        endpoints_.end(),
+        [now](const auto &other)
+        { return other->ejected_until.load(std::memory_order_relaxed) > now; });
+    if ((ejected + 1) * 100 >
+        static_cast<int64_t>(endpoints_.size()) * ejection_max_percent_)
+    {
+        return;
+    }
+
+    const auto until = steady_clock::now() + ejection_time_;
+    endpoint->ejected_until.store(until.time_since_epoch().count(),
+                                  std::memory_order_relaxed);
+    endpoint->failures.store(0, std::memory_order_relaxed);
+
+    Logging::Error("Узел сервиса {}://{}:{} исключен после {} ошибок",
+                   endpoint->schema,
+                   endpoint->host,
+                   endpoint->port,
+                   failures);
+}
+
+//------------------------------------------------------------------------------
+bool LoadBalancer::Available(const Endpoint &endpoint,
+                             const Endpoint *exclude,
+                             steady_clock::rep now,
+                             int pass) noexcept
+{
+    if (pass < 2 && &endpoint == exclude)
+    {
+        return false;
+    }
+
+    return pass > 0 ||
+           endpoint.ejected_until.load(std::memory_order_relaxed) <= now;
+}
+
+//------------------------------------------------------------------------------
+LoadBalancer::Endpoint *LoadBalancer::Select(const Endpoint *exclude,
+                                             steady_clock::rep now,
+                                             int pass) noexcept
+{
+    const size_t size = endpoints_.size();
+
+    if (strategy_ == Strategy::PowerOfTwo && size > 1)
+    {
+        thread_local std::minstd_rand generator{std::random_device{}()};
+
+        std::uniform_int_distribution<size_t> distribution(0, size - 1);
+        const size_t first = distribution(generator);
+        const size_t second =
+            (first + 1 + distribution(generator) % (size - 1)) % size;
+
+        Endpoint *a = endpoints_[first].get();
+        Endpoint *b = endpoints_[second].get();
+        const bool a_available = Available(*a, exclude, now, pass);
+        const bool b_available = Available(*b, exclude, now, pass);
+
+        if (a_available && b_available)
+        {
+            return b->outstanding.load(std::memory_order_relaxed) <
+                           a->outstanding.load(std::memory_order_relaxed)
+                       ? b
+                       : a;
+        }
+        if (a_available)
+        {
+            return a;
+        }
+        if (b_available)
+        {
+            return b;
+        }
+
+        // Оба случайных узла недоступны: выбирается наименее загруженный из
+        // доступных.
+    }
+
+    const size_t start = next_.fetch_add(1, std::memory_order_relaxed);
+
+    Endpoint *selected{nullptr};
+    for (size_t i = 0; i < size; ++i)
+    {
+        Endpoint *endpoint = endpoints_[(start + i) % size].get();
+        if (!Available(*endpoint, exclude, now, pass))
+        {
+            continue;
+        }
+
+        if (strategy_ == Strategy::RoundRobin)
+        {
+            return endpoint;
+        }
+
+        if (selected == nullptr ||
+            endpoint->outstanding.load(std::memory_order_relaxed) <
+                selected->outstanding.load(std::memory_order_relaxed))
+        {
+            selected = endpoint;
+        }
+    }
+
+    return selected;
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,212 @@
+/**
+ * @file
+ * @brief Распределение запросов между узлами сервиса.
+ */
+#ifndef TASP_LOAD_BALANCER_HPP_
+#define TASP_LOAD_BALANCER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Общий для клиентов сервиса распределитель запросов между узлами.
+ *
+ * Параметры загружаются из раздела services.<name>:
+ * - endpoints - список узлов через запятую в формате [schema://]host[:port],
+ * схема и порт по умолчанию берутся из параметров schema и port сервиса;
+ * - balancer - стратегия выбора узла: round_robin (по умолчанию),
+ * least_outstanding (наименьшее количество выполняемых запросов) или
+ * power_of_two (лучший из двух случайных узлов);
+ * - ejection.failures - количество ошибок подряд, после которого узел
+ * исключается из выбора (по умолчанию 5, 0 - узлы не исключаются);
+ * - ejection.time - время исключения узла в миллисекундах (по умолчанию
+ * 30000);
+ * - ejection.max_percent - максимальная доля исключенных узлов в процентах
+ * (по умолчанию 50).
+ *
+ * Ошибкой узла считается временная ошибка передачи или ответ 5xx. Если все
+ * узлы исключены, запросы распределяются между всеми узлами.
+ */
+class LoadBalancer final
+{
+public:
+    /**
+     * @brief Стратегия выбора узла.
+     */
+    enum class Strategy
+    {
+        RoundRobin,        ///< По очереди
+        LeastOutstanding,  ///< Наименьшее количество выполняемых запросов
+        PowerOfTwo         ///< Лучший из двух случайных узлов
+    };
+
+    /**
+     * @brief Узел сервиса и его состояние.
+     */
+    struct Endpoint
+    {
+        /**
+         * @brief Схема.
+         */
+        std::string schema;
+
+        /**
+         * @brief Хост.
+         */
+        std::string host;
+
+        /**
+         * @brief Порт.
+         */
+        std::string port;
+
+        /**
+         * @brief Количество выполняемых запросов.
+         */
+        std::atomic<int64_t> outstanding{0};
+
+        /**
+         * @brief Количество ошибок подряд.
+         */
+        std::atomic<int> failures{0};
+
+        /**
+         * @brief Время окончания исключения узла (steady_clock).
+         */
+        std::atomic<std::chrono::steady_clock::rep> ejected_until{0};
+    };
+
+    /**
+     * @brief Загрузка распределителя из глобального конфигурационного файла.
+     *
+     * @param section Раздел сервиса, заканчивающийся точкой
+     * @param schema Схема сервиса по умолчанию
+     * @param port Порт сервиса по умолчанию
+     *
+     * @return Распределитель, пустой указатель, если список узлов не задан
+     */
+    [[nodiscard]] static std::shared_ptr<LoadBalancer> Load(
+        const std::string &section,
+        std::string_view schema,
+        std::string_view port) noexcept;
+
+    /**
+     * @brief Конструктор.
+     *
+     * @param endpoints Узлы сервиса
+     * @param strategy Стратегия выбора узла
+     */
+    LoadBalancer(std::vector<std::unique_ptr<Endpoint>> endpoints,
+                 Strategy strategy) noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~LoadBalancer() noexcept;
+
+    /**
+     * @brief Выбор узла для выполнения запроса. Увеличивает количество
+     * выполняемых запросов узла. Функция потокобезопасна.
+     *
+     * @param exclude Узел, который выбирается только при отсутствии других,
+     * например узел предыдущей попытки
+     *
+     * @return Узел сервиса
+     */
+    [[nodiscard]] Endpoint *Acquire(const Endpoint *exclude = nullptr) noexcept;
+
+    /**
+     * @brief Завершение запроса к узлу без учета результата, например при
+     * отмене дублирующего запроса. Функция потокобезопасна.
+     *
+     * @param endpoint Узел сервиса
+     */
+    static void Release(Endpoint *endpoint) noexcept;
+
+    /**
+     * @brief Завершение запроса к узлу с учетом результата. Функция
+     * потокобезопасна.
+     *
+     * @param endpoint Узел сервиса
+     * @param failure Признак ошибки узла
+     */
+    void Report(Endpoint *endpoint, bool failure) noexcept;
+
+    LoadBalancer(const LoadBalancer &) = delete;
+    LoadBalancer(LoadBalancer &&) = delete;
+    LoadBalancer &operator=(const LoadBalancer &) = delete;
+    LoadBalancer &operator=(LoadBalancer &&) = delete;
+
+private:
+    /**
+     * @brief Проверка доступности узла для выбора.
+     *
+     * @param endpoint Узел сервиса
+     * @param exclude Исключаемый узел
+     * @param now Текущее время
+     * @param pass Проход выбора: 0 - без исключенных и исключаемого узлов,
+     * 1 - без исключаемого узла, 2 - все узлы
+     *
+     * @return Признак доступности
+     */
+    [[nodiscard]] static bool Available(const Endpoint &endpoint,
+                                        const Endpoint *exclude,
+                                        std::chrono::steady_clock::rep now,
+                                        int pass) noexcept;
+
+    /**
+     * @brief Выбор узла стратегией.
+     *
+     * @param exclude Исключаемый узел
+     * @param now Текущее время
+     * @param pass Проход выбора
+     *
+     * @return Узел сервиса, nullptr - доступных узлов нет
+     */
+    [[nodiscard]] Endpoint *Select(const Endpoint *exclude,
+                                   std::chrono::steady_clock::rep now,
+                                   int pass) noexcept;
+
+    /**
+     * @brief Узлы сервиса.
+     */
+    std::vector<std::unique_ptr<Endpoint>> endpoints_;
+
+    /**
+     * @brief Стратегия выбора узла.
+     */
+    Strategy strategy_;
+
+    /**
+     * @brief Счетчик выбора узлов по очереди.
+     */
+    std::atomic<size_t> next_{0};
+
+    /**
+     * @brief Количество ошибок подряд для исключения узла, 0 - узлы не
+     * исключаются.
+     */
+    int ejection_failures_{5};
+
+    /**
+     * @brief Время исключения узла.
+     */
+    std::chrono::milliseconds ejection_time_{30000};
+
+    /**
+     * @brief Максимальная доля исключенных узлов в процентах.
+     */
+    int ejection_max_percent_{50};
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_LOAD_BALANCER_HPP_
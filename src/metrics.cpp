@@ -0,0 +1,158 @@
+#include "tasp/http/metrics.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <string>
+
+#include "service_metrics.hpp"
+
+using std::string;
+using std::string_view;
+using std::vector;
+using std::chrono::microseconds;
+
+namespace tasp::http
+{
+
+namespace
+{
+
+/**
+ * @brief Формирование значения в секундах для формата Prometheus.
+ *
+ * @param value Значение в микросекундах
+ *
+ * @return Значение в секундах с точностью до микросекунды
+ */
+string Seconds(microseconds value) noexcept
+{
+    const auto total = static_cast<long long>(value.count());
+
+    std::array<char, 32> buffer{};
+    const int length = std::snprintf(buffer.data(),
+                                     buffer.size(),
+                                     "%lld.%06lld",
+                                     total / 1000000LL,
+                                     total % 1000000LL);
+
+    return {buffer.data(), static_cast<size_t>(std::max(length, 0))};
+}
+
+/**
+ * @brief Формирование меток метрик группы для формата Prometheus.
+ *
+ * @param series Метрики группы
+ *
+ * @return Метки без фигурных скобок
+ */
+string Labels(const Metrics::Series &series) noexcept
+{
+    string labels;
+
+    auto append = [&labels](string_view name, string_view value)
+    {
+        if (!labels.empty())
+        {
+            labels.push_back(',');
+        }
+
+        labels.append(name).append("=\"");
+        for (const char symbol : value)
+        {
+            switch (symbol)
+            {
+                case '\\':
+                    labels.append("\\\\");
+                    break;
+                case '"':
+                    labels.append("\\\"");
+                    break;
+                case '\n':
+                    labels.append("\\n");
+                    break;
+                default:
+                    labels.push_back(symbol);
+            }
+        }
+        labels.push_back('"');
+    };
+
+    append("service", series.service);
+    append("method", series.method);
+    append("status", series.status);
+
+    return labels;
+}
+
+}  // namespace
+
+/*------------------------------------------------------------------------------
+    Metrics
+------------------------------------------------------------------------------*/
+vector<Metrics::Series> Metrics::Snapshot() noexcept
+{
+    return MetricsRegistry::Instance().Snapshot();
+}
+
+//------------------------------------------------------------------------------
+string Metrics::Prometheus() noexcept
+{
+    const auto snapshot = Snapshot();
+
+    string requests{
+        "# HELP tasp_http_client_requests_total Количество HTTP-запросов.\n"
+        "# TYPE tasp_http_client_requests_total counter\n"};
+
+    string duration{
+        "# HELP tasp_http_client_request_duration_seconds Длительность "
+        "HTTP-запросов.\n"
+        "# TYPE tasp_http_client_request_duration_seconds histogram\n"};
+
+    for (const auto &series : snapshot)
+    {
+        const string labels = Labels(series);
+        const string count = std::to_string(series.count);
+
+        requests.append("tasp_http_client_requests_total{")
+            .append(labels)
+            .append("} ")
+            .append(count)
+            .append("\n");
+
+        // Для компактности выводятся только границы двукратных диапазонов,
+        // подробные интервалы доступны через Snapshot.
+        for (const auto &[bound, value] : series.buckets)
+        {
+            const bool last = bound == microseconds::max();
+            if (!last && (bound.count() & (bound.count() - 1)) != 0)
+            {
+                continue;
+            }
+
+            duration.append("tasp_http_client_request_duration_seconds_bucket{")
+                .append(labels)
+                .append(",le=\"")
+                .append(last ? string("+Inf") : Seconds(bound))
+                .append("\"} ")
+                .append(std::to_string(value))
+                .append("\n");
+        }
+
+        duration.append("tasp_http_client_request_duration_seconds_sum{")
+            .append(labels)
+            .append("} ")
+            .append(Seconds(series.sum))
+            .append("\n");
+
+        duration.append("tasp_http_client_request_duration_seconds_count{")
+            .append(labels)
+            .append("} ")
+            .append(count)
+            .append("\n");
+    }
+
+    return requests + duration;
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,146 @@
+#include "tasp/http/query.hpp"
+
+#include <array>
+#include <cstdint>
+
+using std::string_view;
+
+namespace tasp::http
+{
+
+namespace
+{
+
+/**
+ * @brief Формирование таблицы символов, не требующих кодирования
+ * (unreserved по RFC 3986).
+ *
+ * @return Таблица признаков по значению символа
+ */
+constexpr std::array<bool, 256> MakeSafeTable() noexcept
+{
+    std::array<bool, 256> table{};
+
+    for (size_t c = '0'; c <= '9'; ++c)
+    {
+        table[c] = true;
+    }
+    for (size_t c = 'A'; c <= 'Z'; ++c)
+    {
+        table[c] = true;
+        table[c - 'A' + 'a'] = true;
+    }
+    table['-'] = true;
+    table['.'] = true;
+    table['_'] = true;
+    table['~'] = true;
+
+    return table;
+}
+
+/**
+ * @brief Таблица символов, не требующих кодирования.
+ */
+constexpr auto safe_table = MakeSafeTable();
+
+/**
+ * @brief Шестнадцатеричные цифры для кодирования символов.
+ */
+constexpr string_view hex_digits{"0123456789ABCDEF"};
+
+}  // namespace
+
+/*------------------------------------------------------------------------------
+    QueryBuilder
+------------------------------------------------------------------------------*/
+QueryBuilder::QueryBuilder() noexcept = default;
+
+//------------------------------------------------------------------------------
+QueryBuilder::~QueryBuilder() noexcept = default;
+
+//------------------------------------------------------------------------------
+void QueryBuilder::Append(string_view name, string_view value) noexcept
+{
+    if (!buffer_.empty())
+    {
+        buffer_.push_back('&');
+    }
+
+    Encode(name);
+    buffer_.push_back('=');
+    Encode(value);
+}
+
+//------------------------------------------------------------------------------
+void QueryBuilder::Append(string_view name,
+                          const url::ParamValueVector &values) noexcept
+{
+    if (!buffer_.empty())
+    {
+        buffer_.push_back('&');
+    }
+
+    Encode(name);
+    buffer_.push_back('=');
+
+    bool first{true};
+    for (const auto &value : values)
+    {
+        if (!first)
+        {
+            buffer_.push_back(',');
+        }
+        first = false;
+
+        Encode(value);
+    }
+}
+
+//------------------------------------------------------------------------------
+void QueryBuilder::Reserve(size_t size) noexcept
+{
+    buffer_.reserve(size);
+}
+
+//------------------------------------------------------------------------------
+void QueryBuilder::Clear() noexcept
+{
+    buffer_.clear();
+}
+
+//------------------------------------------------------------------------------
+string_view QueryBuilder::View() const noexcept
+{
+    return buffer_;
+}
+
+//------------------------------------------------------------------------------
+void QueryBuilder::Encode(string_view value) noexcept
+{
+    // Последовательности символов без кодирования копируются целиком, что
+    // для типичных значений сводит кодирование к одному копированию.
+    while (!value.empty())
+    {
+        size_t length{0};
+        while (length < value.size() &&
+               safe_table[static_cast<uint8_t>(value[length])])
+        {
+            ++length;
+        }
+
+        buffer_.append(value.data(), length);
+        if (length == value.size())
+        {
+            return;
+        }
+
+        const auto c = static_cast<uint8_t>(value[length]);
+        const std::array<char, 3> encoded{
+            '%', hex_digits[c >> 4U], hex_digits[c & 0xFU]};
+        buffer_.append(encoded.data(), encoded.size());
+
+        value.remove_prefix(length + 1);
+    }
+}
+
+}  // namespace tasp::http
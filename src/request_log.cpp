@@ -0,0 +1,301 @@
+#include "request_log.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <tasp/config.hpp>
+#include <tasp/logging.hpp>
+
+using std::string;
+using std::string_view;
+using std::unique_lock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+namespace tasp::http
+{
+
+namespace
+{
+
+/**
+ * @brief Добавление строки в формате JSON.
+ *
+ * @param value Строка
+ * @param line Строка, в конец которой добавляется значение
+ */
+void AppendJsonString(string_view value, string &line) noexcept
+{
+    static constexpr string_view hex{"0123456789abcdef"};
+
+    line.push_back('"');
+    for (const char symbol : value)
+    {
+        switch (symbol)
+        {
+            case '"':
+                line.append("\\\"");
+                break;
+            case '\\':
+                line.append("\\\\");
+                break;
+            default:
+                if (static_cast<unsigned char>(symbol) < 0x20)
+                {
+                    const auto code = static_cast<unsigned char>(symbol);
+                    line.append("\\u00")
+                        .append(1, hex.at(code >> 4U))
+                        .append(1, hex.at(code & 0xFU));
+                }
+                else
+                {
+                    line.push_back(symbol);
+                }
+        }
+    }
+    line.push_back('"');
+}
+
+}  // namespace
+
+/*------------------------------------------------------------------------------
+    RequestLog
+------------------------------------------------------------------------------*/
+RequestLog &RequestLog::Instance() noexcept
+{
+    static RequestLog *const log = new RequestLog();
+    return *log;
+}
+
+//------------------------------------------------------------------------------
+RequestLog::RequestLog() noexcept
+{
+    auto &config_file = ConfigGlobal::Instance();
+
+    // Отрицательные значения заменяются на 0, а не преобразуются в большие
+    // беззнаковые.
+    auto load = [&config_file](const char *param, int value)
+    { return std::max(config_file.Get<int>(param, value), 0); };
+
+    sample_ = static_cast<uint64_t>(load("http.log.sample", 1));
+    rate_ = static_cast<uint64_t>(load("http.log.rate", 0));
+    queue_limit_ = static_cast<size_t>(load("http.log.queue", 65536));
+
+    const auto path = config_file.Get<string>("http.log.file", string());
+    if (path.empty())
+    {
+        return;
+    }
+
+    file_ = std::fopen(path.c_str(), "ae");
+    if (file_ == nullptr)
+    {
+        Logging::Error("Ошибка открытия файла журнала запросов {}: {}",
+                       path,
+                       std::strerror(errno));
+        return;
+    }
+
+    thread_ = std::thread(&RequestLog::Run, this);
+
+    // Объект не удаляется, поэтому очередь выводится в файл при завершении
+    // процесса отдельно.
+    std::atexit([] { Instance().Stop(); });
+}
+
+//------------------------------------------------------------------------------
+RequestLog::~RequestLog() noexcept = default;
+
+//------------------------------------------------------------------------------
+bool RequestLog::Sample() noexcept
+{
+    if (sample_ == 0)
+    {
+        return false;
+    }
+
+    if (sample_ > 1 &&
+        counter_.fetch_add(1, std::memory_order_relaxed) % sample_ != 0)
+    {
+        return false;
+    }
+
+    if (rate_ != 0)
+    {
+        const int64_t now =
+            duration_cast<std::chrono::seconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+
+        int64_t second = second_.load(std::memory_order_relaxed);
+        if (second != now &&
+            second_.compare_exchange_strong(
+                second, now, std::memory_order_relaxed))
+        {
+            second_count_.store(0, std::memory_order_relaxed);
+        }
+
+        if (second_count_.fetch_add(1, std::memory_order_relaxed) >= rate_)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void RequestLog::Write(Request::Method method,
+                       string_view url,
+                       int64_t code,
+                       microseconds duration,
+                       CURLcode result) noexcept
+{
+    if (file_ == nullptr)
+    {
+        // Ошибки выводятся в общий журнал при завершении запроса.
+        if (result == CURLcode::CURLE_OK)
+        {
+            Logging::Info("HTTP-запрос {} {} {}",
+                          Request::MethodToString(method),
+                          url,
+                          code);
+        }
+        return;
+    }
+
+    Entry entry{std::chrono::system_clock::now(),
+                method,
+                string(url),
+                code,
+                duration,
+                result};
+
+    {
+        const std::lock_guard lock(mutex_);
+
+        // После остановки потока записи выводятся в файл сразу.
+        if (stopped_)
+        {
+            string line;
+            Format(entry, line);
+            std::fwrite(line.data(), 1, line.size(), file_);
+            std::fflush(file_);
+            return;
+        }
+
+        if (queue_.size() >= queue_limit_)
+        {
+            ++dropped_;
+        }
+        else
+        {
+            queue_.push_back(std::move(entry));
+        }
+    }
+
+    condition_.notify_one();
+}
+
+//------------------------------------------------------------------------------
+void RequestLog::Stop() noexcept
+{
+    {
+        const std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+
+    condition_.notify_one();
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+//------------------------------------------------------------------------------
+void RequestLog::Run() noexcept
+{
+    std::vector<Entry> pending;
+    string buffer;
+
+    bool stopping{false};
+    while (!stopping)
+    {
+        uint64_t dropped{0};
+
+        {
+            unique_lock lock(mutex_);
+            condition_.wait(lock,
+                            [this] {
+                                return !queue_.empty() || dropped_ != 0 ||
+                                       stopping_;
+                            });
+
+            pending.swap(queue_);
+            std::swap(dropped, dropped_);
+            stopping = stopping_;
+        }
+
+        if (dropped != 0)
+        {
+            Logging::Error("Переполнение очереди журнала запросов, "
+                           "пропущено записей: {}",
+                           dropped);
+        }
+
+        buffer.clear();
+        for (const auto &entry : pending)
+        {
+            Format(entry, buffer);
+        }
+        pending.clear();
+
+        std::fwrite(buffer.data(), 1, buffer.size(), file_);
+        std::fflush(file_);
+    }
+
+    // Записи, добавленные после последнего извлечения очереди.
+    const std::lock_guard lock(mutex_);
+    buffer.clear();
+    for (const auto &entry : queue_)
+    {
+        Format(entry, buffer);
+    }
+    queue_.clear();
+
+    std::fwrite(buffer.data(), 1, buffer.size(), file_);
+    std::fflush(file_);
+    stopped_ = true;
+}
+
+//------------------------------------------------------------------------------
+void RequestLog::Format(const Entry &entry, string &line) noexcept
+{
+    line.append("{\"time\":")
+        .append(std::to_string(
+            duration_cast<microseconds>(entry.time.time_since_epoch())
+                .count()))
+        .append(",\"method\":");
+    AppendJsonString(Request::MethodToString(entry.method), line);
+
+    line.append(",\"url\":");
+    AppendJsonString(entry.url, line);
+
+    line.append(",\"code\":")
+        .append(std::to_string(entry.code))
+        .append(",\"duration\":")
+        .append(std::to_string(entry.duration.count()));
+
+    if (entry.result != CURLcode::CURLE_OK)
+    {
+        line.append(",\"error\":");
+        AppendJsonString(curl_easy_strerror(entry.result), line);
+    }
+
+    line.append("}\n");
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,224 @@
+/**
+ * @file
+ * @brief Журнал выполненных HTTP-запросов.
+ */
+#ifndef TASP_REQUEST_LOG_HPP_
+#define TASP_REQUEST_LOG_HPP_
+
+#include <curl/curl.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <tasp/http/request.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Журнал выполненных HTTP-запросов с прореживанием и ограничением
+ * частоты записей.
+ *
+ * Параметры журнала загружаются из раздела http.log глобального
+ * конфигурационного файла:
+ * - sample - запись каждого N-го запроса, 0 - журнал отключен (по умолчанию
+ * 1, запись всех запросов);
+ * - rate - максимальное количество записей в секунду, 0 - без ограничения;
+ * - file - файл для записи журнала в формате JSON Lines в отдельном потоке,
+ * если не задан, записи выводятся в общий журнал процесса;
+ * - queue - максимальное количество записей, ожидающих вывода в файл,
+ * остальные записи отбрасываются.
+ *
+ * Отрицательные значения параметров заменяются на 0. Запросы, завершившиеся
+ * ошибкой, записываются всегда.
+ */
+class RequestLog final
+{
+public:
+    /**
+     * @brief Запрос единственного экземпляра.
+     *
+     * Объект не удаляется до завершения процесса, так как запросы
+     * завершаются в том числе из потока асинхронного выполнения. При
+     * завершении процесса (atexit) очередь выводится в файл, поток вывода
+     * останавливается, последующие записи выводятся в файл сразу.
+     *
+     * @return Журнал запросов
+     */
+    static RequestLog &Instance() noexcept;
+
+    /**
+     * @brief Проверка необходимости записи очередного успешного запроса.
+     * Функция потокобезопасна и вызывается до формирования записи.
+     *
+     * @return Признак необходимости записи
+     */
+    [[nodiscard]] bool Sample() noexcept;
+
+    /**
+     * @brief Запись выполненного запроса. Функция потокобезопасна.
+     *
+     * @param method Метод запроса
+     * @param url URL запроса
+     * @param code Код ответа
+     * @param duration Длительность запроса
+     * @param result Результат выполнения запроса библиотекой CURL
+     */
+    void Write(Request::Method method,
+               std::string_view url,
+               int64_t code,
+               std::chrono::microseconds duration,
+               CURLcode result) noexcept;
+
+    RequestLog(const RequestLog &) = delete;
+    RequestLog(RequestLog &&) = delete;
+    RequestLog &operator=(const RequestLog &) = delete;
+    RequestLog &operator=(RequestLog &&) = delete;
+
+private:
+    /**
+     * @brief Запись журнала, ожидающая вывода в файл.
+     */
+    struct Entry
+    {
+        /**
+         * @brief Время завершения запроса.
+         */
+        std::chrono::system_clock::time_point time;
+
+        /**
+         * @brief Метод запроса.
+         */
+        Request::Method method;
+
+        /**
+         * @brief URL запроса.
+         */
+        std::string url;
+
+        /**
+         * @brief Код ответа.
+         */
+        int64_t code;
+
+        /**
+         * @brief Длительность запроса.
+         */
+        std::chrono::microseconds duration;
+
+        /**
+         * @brief Результат выполнения запроса библиотекой CURL.
+         */
+        CURLcode result;
+    };
+
+    /**
+     * @brief Конструктор.
+     */
+    RequestLog() noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~RequestLog() noexcept;
+
+    /**
+     * @brief Функция потока вывода записей в файл.
+     */
+    void Run() noexcept;
+
+    /**
+     * @brief Вывод записей очереди в файл и остановка потока вывода.
+     */
+    void Stop() noexcept;
+
+    /**
+     * @brief Формирование строки журнала в формате JSON.
+     *
+     * @param entry Запись журнала
+     * @param line Строка, в конец которой добавляется запись
+     */
+    static void Format(const Entry &entry, std::string &line) noexcept;
+
+    /**
+     * @brief Период записи запросов.
+     */
+    uint64_t sample_{1};
+
+    /**
+     * @brief Максимальное количество записей в секунду.
+     */
+    uint64_t rate_{0};
+
+    /**
+     * @brief Максимальное количество записей в очереди.
+     */
+    size_t queue_limit_{0};
+
+    /**
+     * @brief Счетчик запросов для прореживания.
+     */
+    std::atomic<uint64_t> counter_{0};
+
+    /**
+     * @brief Текущая секунда ограничения частоты записей.
+     */
+    std::atomic<int64_t> second_{0};
+
+    /**
+     * @brief Количество записей в текущей секунде.
+     */
+    std::atomic<uint64_t> second_count_{0};
+
+    /**
+     * @brief Файл журнала.
+     */
+    std::FILE *file_{nullptr};
+
+    /**
+     * @brief Блокировка очереди записей.
+     */
+    std::mutex mutex_;
+
+    /**
+     * @brief Условная переменная для ожидания записей.
+     */
+    std::condition_variable condition_;
+
+    /**
+     * @brief Записи, ожидающие вывода в файл.
+     */
+    std::vector<Entry> queue_;
+
+    /**
+     * @brief Количество отброшенных записей при переполнении очереди.
+     */
+    uint64_t dropped_{0};
+
+    /**
+     * @brief Признак запроса остановки потока вывода.
+     */
+    bool stopping_{false};
+
+    /**
+     * @brief Признак остановки потока вывода.
+     */
+    bool stopped_{false};
+
+    /**
+     * @brief Поток вывода записей в файл.
+     */
+    std::thread thread_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_REQUEST_LOG_HPP_
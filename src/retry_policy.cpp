@@ -0,0 +1,134 @@
+#include "retry_policy.hpp"
+
+#include <algorithm>
+#include <random>
+
+#include <tasp/config.hpp>
+
+#include "transport_error.hpp"
+
+using std::string;
+using std::chrono::milliseconds;
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    RetryBudget
+------------------------------------------------------------------------------*/
+RetryBudget::RetryBudget(int percent) noexcept
+: deposit_(std::clamp<int64_t>(percent, 0, cost))
+{
+}
+
+//------------------------------------------------------------------------------
+RetryBudget::~RetryBudget() noexcept = default;
+
+//------------------------------------------------------------------------------
+void RetryBudget::Deposit() noexcept
+{
+    int64_t balance = balance_.load(std::memory_order_relaxed);
+    while (balance < limit &&
+           !balance_.compare_exchange_weak(balance,
+                                           std::min(balance + deposit_, limit),
+                                           std::memory_order_relaxed))
+    {
+    }
+}
+
+//------------------------------------------------------------------------------
+bool RetryBudget::Withdraw() noexcept
+{
+    int64_t balance = balance_.load(std::memory_order_relaxed);
+    while (balance >= cost)
+    {
+        if (balance_.compare_exchange_weak(
+                balance, balance - cost, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*------------------------------------------------------------------------------
+    RetryPolicy
+------------------------------------------------------------------------------*/
+RetryPolicy RetryPolicy::Load(const string &section) noexcept
+{
+    RetryPolicy policy;
+
+    auto &config_file = ConfigGlobal::Instance();
+
+    auto load = [&](const char *param, milliseconds &value)
+    {
+        value = milliseconds{std::max(
+            config_file.Get<int>(section + param,
+                                 static_cast<int>(value.count())),
+            0)};
+    };
+
+    policy.attempts =
+        std::max(config_file.Get<int>(section + "attempts", policy.attempts),
+                 0);
+    policy.budget = config_file.Get<int>(section + "budget", policy.budget);
+
+    load("backoff", policy.backoff);
+    load("max_backoff", policy.max_backoff);
+    load("hedge_delay", policy.hedge_delay);
+
+    return policy;
+}
+
+//------------------------------------------------------------------------------
+bool RetryPolicy::Retryable(Request::Method method,
+                            CURLcode result,
+                            int64_t code) noexcept
+{
+    if (!Idempotent(method))
+    {
+        return false;
+    }
+
+    if (result == CURLE_OK)
+    {
+        return code == 502 || code == 503 || code == 504;
+    }
+
+    return MakeTransportError(result).retriable;
+}
+
+//------------------------------------------------------------------------------
+bool RetryPolicy::Idempotent(Request::Method method) noexcept
+{
+    switch (method)
+    {
+        case Request::Method::Get:
+        case Request::Method::Head:
+        case Request::Method::Put:
+        case Request::Method::Delete:
+        case Request::Method::Options:
+            return true;
+        default:
+            return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+milliseconds RetryPolicy::Backoff(int attempt) const noexcept
+{
+    thread_local std::minstd_rand generator{std::random_device{}()};
+
+    const int shift = std::min(attempt, 20);
+    const auto limit = std::min(backoff * (int64_t{1} << shift), max_backoff);
+    if (limit.count() <= 0)
+    {
+        return milliseconds{0};
+    }
+
+    std::uniform_int_distribution<int64_t> distribution(0, limit.count());
+    return milliseconds{distribution(generator)};
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,173 @@
+/**
+ * @file
+ * @brief Политика повторного выполнения HTTP-запросов.
+ */
+#ifndef TASP_RETRY_POLICY_HPP_
+#define TASP_RETRY_POLICY_HPP_
+
+#include <curl/curl.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <tasp/http/request.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Общий для клиентов сервиса бюджет повторных запросов.
+ *
+ * Каждый запрос пополняет бюджет на заданную долю, каждый повторный или
+ * дублирующий запрос расходует единицу бюджета. Бюджет ограничивает долю
+ * повторных запросов и предотвращает лавинообразный рост нагрузки на
+ * недоступный сервис.
+ */
+class RetryBudget final
+{
+public:
+    /**
+     * @brief Конструктор.
+     *
+     * @param percent Доля повторных запросов в процентах от количества
+     * запросов
+     */
+    explicit RetryBudget(int percent) noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~RetryBudget() noexcept;
+
+    /**
+     * @brief Пополнение бюджета при выполнении запроса. Функция
+     * потокобезопасна.
+     */
+    void Deposit() noexcept;
+
+    /**
+     * @brief Расход бюджета на повторный запрос. Функция потокобезопасна.
+     *
+     * @return Признак достаточности бюджета
+     */
+    [[nodiscard]] bool Withdraw() noexcept;
+
+    RetryBudget(const RetryBudget &) = delete;
+    RetryBudget(RetryBudget &&) = delete;
+    RetryBudget &operator=(const RetryBudget &) = delete;
+    RetryBudget &operator=(RetryBudget &&) = delete;
+
+private:
+    /**
+     * @brief Стоимость одного повторного запроса.
+     */
+    static constexpr int64_t cost{100};
+
+    /**
+     * @brief Максимальный бюджет: 10 повторных запросов подряд.
+     */
+    static constexpr int64_t limit{10 * cost};
+
+    /**
+     * @brief Пополнение бюджета на один запрос.
+     */
+    int64_t deposit_;
+
+    /**
+     * @brief Текущий бюджет.
+     */
+    std::atomic<int64_t> balance_{limit};
+};
+
+/**
+ * @brief Политика повторного выполнения запросов к сервису.
+ *
+ * Параметры загружаются из раздела services.<name>.retry:
+ * - attempts - количество повторных попыток (по умолчанию 0);
+ * - backoff - начальная задержка перед повторной попыткой в миллисекундах;
+ * - max_backoff - максимальная задержка в миллисекундах;
+ * - budget - доля повторных запросов в процентах от количества запросов;
+ * - hedge_delay - минимальная задержка отправки дублирующего запроса в
+ * миллисекундах, 0 - дублирующие запросы не отправляются.
+ *
+ * Отрицательные значения задержек заменяются на 0.
+ *
+ * Повторно выполняются только идемпотентные запросы (GET, HEAD, PUT, DELETE,
+ * OPTIONS) при временной ошибке передачи (TransportError::retriable) или
+ * ответе 502, 503, 504.
+ */
+struct RetryPolicy
+{
+    /**
+     * @brief Загрузка политики из глобального конфигурационного файла.
+     *
+     * @param section Раздел конфигурационного файла, заканчивающийся точкой
+     *
+     * @return Политика повторного выполнения
+     */
+    [[nodiscard]] static RetryPolicy Load(const std::string &section) noexcept;
+
+    /**
+     * @brief Проверка допустимости повторного выполнения запроса.
+     *
+     * @param method Метод запроса
+     * @param result Результат выполнения запроса библиотекой CURL
+     * @param code Код ответа
+     *
+     * @return Признак допустимости повтора
+     */
+    [[nodiscard]] static bool Retryable(Request::Method method,
+                                        CURLcode result,
+                                        int64_t code) noexcept;
+
+    /**
+     * @brief Проверка идемпотентности метода запроса.
+     *
+     * @param method Метод запроса
+     *
+     * @return Признак идемпотентности
+     */
+    [[nodiscard]] static bool Idempotent(Request::Method method) noexcept;
+
+    /**
+     * @brief Расчет задержки перед повторной попыткой: экспоненциальный рост
+     * со случайным разбросом от нуля до расчетного значения.
+     *
+     * @param attempt Номер выполненной попытки, начиная с 0
+     *
+     * @return Задержка
+     */
+    [[nodiscard]] std::chrono::milliseconds Backoff(
+        int attempt) const noexcept;
+
+    /**
+     * @brief Количество повторных попыток.
+     */
+    int attempts{0};
+
+    /**
+     * @brief Начальная задержка перед повторной попыткой.
+     */
+    std::chrono::milliseconds backoff{100};
+
+    /**
+     * @brief Максимальная задержка перед повторной попыткой.
+     */
+    std::chrono::milliseconds max_backoff{2000};
+
+    /**
+     * @brief Доля повторных запросов в процентах.
+     */
+    int budget{20};
+
+    /**
+     * @brief Минимальная задержка отправки дублирующего запроса.
+     */
+    std::chrono::milliseconds hedge_delay{0};
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_RETRY_POLICY_HPP_
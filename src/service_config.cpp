@@ -0,0 +1,217 @@
+#include "service_config.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <type_traits>
+
+#include <tasp/config.hpp>
+#include <tasp/logging.hpp>
+
+using std::make_shared;
+using std::shared_lock;
+using std::shared_ptr;
+using std::string;
+using std::string_view;
+using std::to_string;
+using std::unique_lock;
+
+namespace tasp::http
+{
+
+namespace
+{
+
+/**
+ * @brief Время передачи со скоростью ниже минимальной до прерывания запроса,
+ * если задана только минимальная скорость.
+ */
+constexpr std::chrono::seconds default_low_speed_time{30};
+
+/**
+ * @brief Преобразование версии протокола HTTP из конфигурационного файла.
+ *
+ * @param version Версия: 1.0, 1.1, 2 (HTTP/2 при поддержке сервером), 2tls
+ * (HTTP/2 только для HTTPS) или h2c (HTTP/2 без TLS без согласования)
+ *
+ * @return Значение CURL_HTTP_VERSION_*
+ */
+// NOLINTNEXTLINE(google-runtime-int)
+long ParseHttpVersion(string_view version) noexcept
+{
+    if (version == "1.0")
+    {
+        return CURL_HTTP_VERSION_1_0;
+    }
+    if (version == "1.1")
+    {
+        return CURL_HTTP_VERSION_1_1;
+    }
+    if (version == "2")
+    {
+        return CURL_HTTP_VERSION_2_0;
+    }
+    if (version == "2tls")
+    {
+        return CURL_HTTP_VERSION_2TLS;
+    }
+    if (version == "h2c")
+    {
+        return CURL_HTTP_VERSION_2_PRIOR_KNOWLEDGE;
+    }
+
+    if (!version.empty())
+    {
+        Logging::Error("Неизвестная версия протокола HTTP: {}", version);
+    }
+
+    return CURL_HTTP_VERSION_NONE;
+}
+
+}  // namespace
+
+/*------------------------------------------------------------------------------
+    ServiceConfig
+------------------------------------------------------------------------------*/
+ServiceConfig ServiceConfig::Load(string_view name) noexcept
+{
+    ServiceConfig config;
+    config.name = name;
+
+    string section{"services."};
+    section.append(name).append(".");
+
+    auto &config_file = ConfigGlobal::Instance();
+
+    auto load = [&](string_view param, string &value)
+    { value = config_file.Get<string>(section + param.data(), value); };
+
+    load("schema", config.schema);
+    load("host", config.host);
+    load("port", config.port);
+    load("prefix", config.prefix);
+    load("accept_encoding", config.accept_encoding);
+
+    config.share = config_file.Get<bool>(section + "share", config.share);
+    // Отрицательный размер при преобразовании в size_t снимал бы ограничение.
+    config.max_body_size = std::max<int64_t>(
+        config_file.Get<int64_t>(section + "max_body_size",
+                                 config.max_body_size),
+        0);
+
+    config.http_version = ParseHttpVersion(
+        config_file.Get<string>(section + "http_version", string()));
+
+    auto load_duration = [&](string_view param, auto &value)
+    {
+        using Duration = std::remove_reference_t<decltype(value)>;
+        // Отрицательное время ожидания завершало бы все запросы ошибкой.
+        value = Duration{std::max<int64_t>(
+            config_file.Get<int64_t>(section + param.data(), value.count()),
+            0)};
+    };
+
+    load_duration("timeout", config.timeout);
+    load_duration("connect_timeout", config.connect_timeout);
+    load_duration("low_speed_time", config.low_speed_time);
+
+    config.low_speed_limit = static_cast<long>(  // NOLINT(google-runtime-int)
+        std::max<int64_t>(config_file.Get<int64_t>(section + "low_speed_limit",
+                                                   config.low_speed_limit),
+                          0));
+
+    // Библиотека CURL не проверяет скорость при нулевом времени.
+    if (config.low_speed_limit != 0 && config.low_speed_time.count() == 0)
+    {
+        config.low_speed_time = default_low_speed_time;
+    }
+
+    config.compress_min_size = config_file.Get<int64_t>(
+        section + "compress_min_size", config.compress_min_size);
+    config.compress_level =
+        config_file.Get<int>(section + "compress_level", config.compress_level);
+
+    config.retry = RetryPolicy::Load(section + "retry.");
+    config.retry_budget = make_shared<RetryBudget>(config.retry.budget);
+
+    config.balancer = LoadBalancer::Load(section, config.schema, config.port);
+
+    config.origin = config.schema + "://" + config.host + ":" + config.port;
+    config.metrics = MetricsRegistry::Instance().Get(config.name);
+
+    config.url.reset(curl_url(), curl_url_cleanup);
+    const CURLUcode code = curl_url_set(
+        config.url.get(), CURLUPART_URL, config.origin.c_str(), 0);
+    if (code != CURLUE_OK)
+    {
+        Logging::Error("Ошибка парсинга URI: {}", config.origin);
+        config.url.reset();
+    }
+
+    return config;
+}
+
+//------------------------------------------------------------------------------
+ServiceConfig ServiceConfig::Address(string_view host, int port) noexcept
+{
+    ServiceConfig config;
+    config.schema.clear();
+    config.host = host;
+    config.port = to_string(port);
+    config.prefix.clear();
+    config.origin = config.host + ":" + config.port;
+    config.name = config.origin;
+    config.metrics = MetricsRegistry::Instance().Get(config.name);
+    config.retry_budget = make_shared<RetryBudget>(config.retry.budget);
+
+    return config;
+}
+
+//------------------------------------------------------------------------------
+const string &ServiceConfig::Origin() const noexcept
+{
+    return origin;
+}
+
+/*------------------------------------------------------------------------------
+    ServiceRegistry
+------------------------------------------------------------------------------*/
+ServiceRegistry &ServiceRegistry::Instance() noexcept
+{
+    static ServiceRegistry registry;
+    return registry;
+}
+
+//------------------------------------------------------------------------------
+ServiceRegistry::ServiceRegistry() noexcept = default;
+
+//------------------------------------------------------------------------------
+ServiceRegistry::~ServiceRegistry() noexcept = default;
+
+//------------------------------------------------------------------------------
+shared_ptr<const ServiceConfig> ServiceRegistry::Get(string_view name) noexcept
+{
+    {
+        const shared_lock lock(mutex_);
+
+        auto service = services_.find(name);
+        if (service != services_.end())
+        {
+            return service->second;
+        }
+    }
+
+    auto service = make_shared<const ServiceConfig>(ServiceConfig::Load(name));
+
+    const unique_lock lock(mutex_);
+    return services_.try_emplace(string(name), std::move(service))
+        .first->second;
+}
+
+//------------------------------------------------------------------------------
+void ServiceRegistry::Invalidate() noexcept
+{
+    const unique_lock lock(mutex_);
+    services_.clear();
+}
+
+}  // namespace tasp::http
@@ -0,0 +1,239 @@
+/**
+ * @file
+ * @brief Параметры сервиса из глобального конфигурационного файла.
+ */
+#ifndef TASP_SERVICE_CONFIG_HPP_
+#define TASP_SERVICE_CONFIG_HPP_
+
+#include <curl/curl.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+
+#include "load_balancer.hpp"
+#include "retry_policy.hpp"
+#include "service_metrics.hpp"
+
+namespace tasp::http
+{
+
+/**
+ * @brief Параметры сервиса, загружаемые из раздела services.<name>.
+ */
+struct ServiceConfig
+{
+    /**
+     * @brief Загрузка параметров сервиса из глобального конфигурационного
+     * файла.
+     *
+     * @param name Название сервиса в разделе services
+     *
+     * @return Параметры сервиса
+     */
+    [[nodiscard]] static ServiceConfig Load(std::string_view name) noexcept;
+
+    /**
+     * @brief Формирование параметров для сервиса, заданного адресом.
+     *
+     * @param host Хост сервиса
+     * @param port Порт сервиса
+     *
+     * @return Параметры сервиса
+     */
+    [[nodiscard]] static ServiceConfig Address(std::string_view host,
+                                               int port) noexcept;
+
+    /**
+     * @brief Запрос источника (схема, хост и порт) сервиса.
+     *
+     * @return Источник в формате schema://host:port или host:port, если схема
+     * не задана
+     */
+    [[nodiscard]] const std::string &Origin() const noexcept;
+
+    /**
+     * @brief Название сервиса.
+     */
+    std::string name;
+
+    /**
+     * @brief Источник сервиса.
+     */
+    std::string origin;
+
+    /**
+     * @brief Разобранный источник сервиса для копирования в URL запросов.
+     */
+    std::shared_ptr<CURLU> url;
+
+    /**
+     * @brief Схема.
+     */
+    std::string schema{"http"};
+
+    /**
+     * @brief Хост.
+     */
+    std::string host{"127.0.0.1"};
+
+    /**
+     * @brief Порт.
+     */
+    std::string port{"80"};
+
+    /**
+     * @brief Префикс пути запроса.
+     */
+    std::string prefix{"/api/v1"};
+
+    /**
+     * @brief Признак использования общих кэшей DNS, TLS-сессий и соединений.
+     */
+    bool share{true};
+
+    /**
+     * @brief Максимальный размер данных ответа в байтах, 0 - без ограничения,
+     * отрицательные значения заменяются на 0.
+     */
+    int64_t max_body_size{0};
+
+    /**
+     * @brief Версия протокола HTTP (значение CURL_HTTP_VERSION_*).
+     */
+    long http_version{CURL_HTTP_VERSION_NONE};  // NOLINT(google-runtime-int)
+
+    /**
+     * @brief Время выполнения запроса с учетом повторных попыток, 0 - без
+     * ограничения.
+     */
+    std::chrono::milliseconds timeout{0};
+
+    /**
+     * @brief Время установления соединения, 0 - значение библиотеки CURL
+     * (300 с).
+     */
+    std::chrono::milliseconds connect_timeout{0};
+
+    /**
+     * @brief Минимальная скорость передачи в байтах в секунду, 0 - без
+     * ограничения.
+     */
+    long low_speed_limit{0};  // NOLINT(google-runtime-int)
+
+    /**
+     * @brief Время передачи со скоростью ниже минимальной до прерывания
+     * запроса, 30 с, если задана только минимальная скорость.
+     */
+    std::chrono::seconds low_speed_time{0};
+
+    /**
+     * @brief Список кодировок сжатия ответа для заголовка Accept-Encoding,
+     * например "gzip, br", all - все кодировки библиотеки CURL, пустая
+     * строка - сжатие ответа не запрашивается.
+     */
+    std::string accept_encoding;
+
+    /**
+     * @brief Минимальный размер данных запроса в байтах для сжатия gzip,
+     * 0 - данные запроса не сжимаются.
+     */
+    int64_t compress_min_size{0};
+
+    /**
+     * @brief Уровень сжатия данных запроса от 1 до 9, -1 - уровень по
+     * умолчанию библиотеки zlib.
+     */
+    int compress_level{-1};
+
+    /**
+     * @brief Метрики запросов к сервису.
+     */
+    ServiceMetrics *metrics{nullptr};
+
+    /**
+     * @brief Политика повторного выполнения запросов.
+     */
+    RetryPolicy retry;
+
+    /**
+     * @brief Бюджет повторных запросов.
+     */
+    std::shared_ptr<RetryBudget> retry_budget;
+
+    /**
+     * @brief Распределитель запросов между узлами сервиса, пустой указатель -
+     * запросы выполняются к единственному узлу host:port.
+     */
+    std::shared_ptr<LoadBalancer> balancer;
+};
+
+/**
+ * @brief Общий для процесса кэш параметров сервисов.
+ *
+ * Параметры сервиса загружаются из глобального конфигурационного файла при
+ * первом обращении и используются всеми клиентами до сброса кэша.
+ */
+class ServiceRegistry final
+{
+public:
+    /**
+     * @brief Запрос единственного экземпляра кэша.
+     *
+     * @return Кэш параметров сервисов
+     */
+    static ServiceRegistry &Instance() noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~ServiceRegistry() noexcept;
+
+    /**
+     * @brief Запрос параметров сервиса. Функция потокобезопасна.
+     *
+     * @param name Название сервиса в разделе services
+     *
+     * @return Параметры сервиса
+     */
+    [[nodiscard]] std::shared_ptr<const ServiceConfig> Get(
+        std::string_view name) noexcept;
+
+    /**
+     * @brief Сброс кэша, например после перезагрузки конфигурационного
+     * файла. Клиенты, созданные ранее, сохраняют прежние параметры.
+     */
+    void Invalidate() noexcept;
+
+    ServiceRegistry(const ServiceRegistry &) = delete;
+    ServiceRegistry(ServiceRegistry &&) = delete;
+    ServiceRegistry &operator=(const ServiceRegistry &) = delete;
+    ServiceRegistry &operator=(ServiceRegistry &&) = delete;
+
+private:
+    /**
+     * @brief Конструктор.
+     */
+    ServiceRegistry() noexcept;
+
+    /**
+     * @brief Блокировка кэша.
+     */
+    std::shared_mutex mutex_;
+
+    /**
+     * @brief Параметры сервисов по названиям, поиск выполняется по
+     * string_view без формирования строки.
+     */
+    std::map<std::string, std::shared_ptr<const ServiceConfig>, std::less<>>
+        services_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_SERVICE_CONFIG_HPP_
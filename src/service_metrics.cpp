@@ -0,0 +1,280 @@
+#include "service_metrics.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+using std::shared_lock;
+using std::string;
+using std::string_view;
+using std::unique_lock;
+using std::vector;
+using std::chrono::microseconds;
+
+namespace tasp::http
+{
+
+namespace
+{
+
+/**
+ * @brief Степень двойки нижней границы логарифмических интервалов (64 мкс).
+ */
+constexpr unsigned min_exponent{6};
+
+/**
+ * @brief Степень двойки верхней границы логарифмических интервалов.
+ */
+constexpr unsigned max_exponent{26};
+
+/**
+ * @brief Количество разрядов номера интервала внутри двукратного диапазона.
+ */
+constexpr unsigned sub_bucket_bits{2};
+
+/**
+ * @brief Названия классов кодов ответа.
+ */
+constexpr std::array<string_view, 6> status_names{
+    "error", "1xx", "2xx", "3xx", "4xx", "5xx"};
+
+}  // namespace
+
+/*------------------------------------------------------------------------------
+    Histogram
+------------------------------------------------------------------------------*/
+Histogram::Histogram() noexcept = default;
+
+//------------------------------------------------------------------------------
+Histogram::~Histogram() noexcept = default;
+
+//------------------------------------------------------------------------------
+void Histogram::Record(microseconds duration) noexcept
+{
+    const auto value = static_cast<uint64_t>(std::max<int64_t>(
+        duration.count(), 0));
+
+    buckets_.at(Index(value)).fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+microseconds Histogram::UpperBound(size_t index) noexcept
+{
+    if (index == 0)
+    {
+        return microseconds{1LL << min_exponent};
+    }
+    if (index >= buckets_count - 1)
+    {
+        return microseconds::max();
+    }
+
+    const size_t exponent = min_exponent + ((index - 1) >> sub_bucket_bits);
+    const size_t sub = ((index - 1) & ((1U << sub_bucket_bits) - 1)) + 1;
+
+    return microseconds{static_cast<int64_t>(
+        (1ULL << exponent) + (sub << (exponent - sub_bucket_bits)))};
+}
+
+//------------------------------------------------------------------------------
+void Histogram::Snapshot(Metrics::Series &series) const noexcept
+{
+    series.buckets.clear();
+    series.buckets.reserve(buckets_count);
+
+    uint64_t count{0};
+    for (size_t index = 0; index < buckets_count; ++index)
+    {
+        count += buckets_.at(index).load(std::memory_order_relaxed);
+        series.buckets.emplace_back(UpperBound(index), count);
+    }
+
+    series.count = count;
+    series.sum = microseconds{
+        static_cast<int64_t>(sum_.load(std::memory_order_relaxed))};
+}
+
+//------------------------------------------------------------------------------
+microseconds Histogram::Quantile(double quantile,
+                                 uint64_t min_count) const noexcept
+{
+    std::array<uint64_t, buckets_count> counts{};
+
+    uint64_t total{0};
+    for (size_t index = 0; index < buckets_count; ++index)
+    {
+        counts.at(index) = buckets_.at(index).load(std::memory_order_relaxed);
+        total += counts.at(index);
+    }
+
+    if (total == 0 || total < min_count)
+    {
+        return microseconds{0};
+    }
+
+    const auto rank = static_cast<uint64_t>(
+        std::clamp(quantile, 0.0, 1.0) * static_cast<double>(total - 1));
+
+    uint64_t count{0};
+    for (size_t index = 0; index < buckets_count; ++index)
+    {
+        count += counts.at(index);
+        if (count > rank)
+        {
+            return UpperBound(index);
+        }
+    }
+
+    return microseconds::max();
+}
+
+//------------------------------------------------------------------------------
+size_t Histogram::Index(uint64_t value) noexcept
+{
+    // Границы интервалов включаются в интервал, поэтому номер вычисляется
+    // для предыдущего значения.
+    const uint64_t previous = value == 0 ? 0 : value - 1;
+    if (previous < (1ULL << min_exponent))
+    {
+        return 0;
+    }
+
+    const auto exponent =
+        static_cast<unsigned>(63 - __builtin_clzll(previous));
+    if (exponent >= max_exponent)
+    {
+        return buckets_count - 1;
+    }
+
+    const uint64_t sub = (previous >> (exponent - sub_bucket_bits)) &
+                         ((1U << sub_bucket_bits) - 1);
+
+    return ((exponent - min_exponent) << sub_bucket_bits) + sub + 1;
+}
+
+/*------------------------------------------------------------------------------
+    ServiceMetrics
+------------------------------------------------------------------------------*/
+ServiceMetrics::ServiceMetrics(string_view name) noexcept
+: name_(name)
+{
+}
+
+//------------------------------------------------------------------------------
+ServiceMetrics::~ServiceMetrics() noexcept = default;
+
+//------------------------------------------------------------------------------
+void ServiceMetrics::Record(Request::Method method,
+                            int64_t code,
+                            microseconds duration) noexcept
+{
+    const auto method_index = static_cast<size_t>(method);
+    if (method_index >= methods_count)
+    {
+        return;
+    }
+
+    const size_t status_index =
+        code >= 100 && code < 600 ? static_cast<size_t>(code / 100) : 0;
+
+    histograms_.at(method_index).at(status_index).Record(duration);
+}
+
+//------------------------------------------------------------------------------
+void ServiceMetrics::Snapshot(vector<Metrics::Series> &series) const noexcept
+{
+    for (size_t method = 0; method < methods_count; ++method)
+    {
+        for (size_t status = 0; status < statuses_count; ++status)
+        {
+            Metrics::Series current;
+            histograms_.at(method).at(status).Snapshot(current);
+            if (current.count == 0)
+            {
+                continue;
+            }
+
+            current.service = name_;
+            current.method = Request::MethodToString(
+                static_cast<Request::Method>(method));
+            current.status = status_names.at(status);
+
+            series.push_back(std::move(current));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+microseconds ServiceMetrics::Quantile(Request::Method method,
+                                      double quantile) const noexcept
+{
+    static constexpr uint64_t min_count{100};
+    static constexpr size_t success_index{2};
+
+    const auto method_index = static_cast<size_t>(method);
+    if (method_index >= methods_count)
+    {
+        return microseconds{0};
+    }
+
+    return histograms_.at(method_index)
+        .at(success_index)
+        .Quantile(quantile, min_count);
+}
+
+/*------------------------------------------------------------------------------
+    MetricsRegistry
+------------------------------------------------------------------------------*/
+MetricsRegistry &MetricsRegistry::Instance() noexcept
+{
+    static MetricsRegistry *const registry = new MetricsRegistry();
+    return *registry;
+}
+
+//------------------------------------------------------------------------------
+MetricsRegistry::MetricsRegistry() noexcept = default;
+
+//------------------------------------------------------------------------------
+MetricsRegistry::~MetricsRegistry() noexcept = default;
+
+//------------------------------------------------------------------------------
+ServiceMetrics *MetricsRegistry::Get(string_view name) noexcept
+{
+    const string key{name};
+
+    {
+        const shared_lock lock(mutex_);
+
+        auto service = services_.find(key);
+        if (service != services_.end())
+        {
+            return service->second.get();
+        }
+    }
+
+    const unique_lock lock(mutex_);
+
+    auto &service = services_[key];
+    if (!service)
+    {
+        service = std::make_unique<ServiceMetrics>(name);
+    }
+
+    return service.get();
+}
+
+//------------------------------------------------------------------------------
+vector<Metrics::Series> MetricsRegistry::Snapshot() const noexcept
+{
+    vector<Metrics::Series> series;
+
+    const shared_lock lock(mutex_);
+    for (const auto &[name, service] : services_)
+    {
+        service->Snapshot(series);
+    }
+
+    return series;
+}
+
+}  // namespace tasp::http
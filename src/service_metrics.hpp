@@ -0,0 +1,253 @@
+/**
+ * @file
+ * @brief Сбор метрик выполнения HTTP-запросов по сервисам.
+ */
+#ifndef TASP_SERVICE_METRICS_HPP_
+#define TASP_SERVICE_METRICS_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <tasp/http/metrics.hpp>
+#include <tasp/http/request.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Гистограмма длительности запросов.
+ *
+ * Интервалы логарифмические: каждый двукратный диапазон от 64 мкс до 2^26 мкс
+ * (около 67 с) разделен на 4 равных интервала, что дает относительную
+ * погрешность не более 25%. Значения обновляются атомарно без блокировок.
+ */
+class Histogram final
+{
+public:
+    /**
+     * @brief Количество интервалов, включая интервалы меньше 64 мкс и больше
+     * 2^26 мкс.
+     */
+    static constexpr size_t buckets_count{82};
+
+    /**
+     * @brief Конструктор.
+     */
+    Histogram() noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~Histogram() noexcept;
+
+    /**
+     * @brief Учет длительности запроса.
+     *
+     * @param duration Длительность запроса
+     */
+    void Record(std::chrono::microseconds duration) noexcept;
+
+    /**
+     * @brief Запрос верхней (включительно) границы интервала.
+     *
+     * @param index Номер интервала
+     *
+     * @return Граница интервала, для последнего интервала -
+     * microseconds::max()
+     */
+    [[nodiscard]] static std::chrono::microseconds UpperBound(
+        size_t index) noexcept;
+
+    /**
+     * @brief Запрос текущих значений гистограммы.
+     *
+     * @param series Метрики группы, в которые записываются количество,
+     * суммарная длительность и накопленные значения интервалов
+     */
+    void Snapshot(Metrics::Series &series) const noexcept;
+
+    /**
+     * @brief Расчет квантиля длительности.
+     *
+     * @param quantile Квантиль от 0 до 1
+     * @param min_count Минимальное количество запросов для расчета
+     *
+     * @return Верхняя граница интервала, содержащего квантиль, или 0, если
+     * запросов недостаточно
+     */
+    [[nodiscard]] std::chrono::microseconds Quantile(
+        double quantile, uint64_t min_count) const noexcept;
+
+    Histogram(const Histogram &) = delete;
+    Histogram(Histogram &&) = delete;
+    Histogram &operator=(const Histogram &) = delete;
+    Histogram &operator=(Histogram &&) = delete;
+
+private:
+    /**
+     * @brief Вычисление номера интервала для длительности.
+     *
+     * @param value Длительность в микросекундах
+     *
+     * @return Номер интервала
+     */
+    [[nodiscard]] static size_t Index(uint64_t value) noexcept;
+
+    /**
+     * @brief Количество запросов по интервалам.
+     */
+    std::array<std::atomic<uint64_t>, buckets_count> buckets_{};
+
+    /**
+     * @brief Суммарная длительность запросов в микросекундах.
+     */
+    std::atomic<uint64_t> sum_{0};
+};
+
+/**
+ * @brief Метрики запросов к одному сервису по методам и классам кодов ответа.
+ */
+class ServiceMetrics final
+{
+public:
+    /**
+     * @brief Конструктор.
+     *
+     * @param name Название сервиса
+     */
+    explicit ServiceMetrics(std::string_view name) noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~ServiceMetrics() noexcept;
+
+    /**
+     * @brief Учет выполненного запроса. Функция потокобезопасна.
+     *
+     * @param method Метод запроса
+     * @param code Код ответа, 0 - ответ не получен
+     * @param duration Длительность запроса
+     */
+    void Record(Request::Method method,
+                int64_t code,
+                std::chrono::microseconds duration) noexcept;
+
+    /**
+     * @brief Добавление текущих значений метрик групп, в которых выполнялись
+     * запросы.
+     *
+     * @param series Список метрик групп
+     */
+    void Snapshot(std::vector<Metrics::Series> &series) const noexcept;
+
+    /**
+     * @brief Расчет квантиля длительности успешных (2xx) запросов.
+     *
+     * @param method Метод запроса
+     * @param quantile Квантиль от 0 до 1
+     *
+     * @return Квантиль длительности или 0, если выполнено менее 100 успешных
+     * запросов
+     */
+    [[nodiscard]] std::chrono::microseconds Quantile(
+        Request::Method method, double quantile) const noexcept;
+
+    ServiceMetrics(const ServiceMetrics &) = delete;
+    ServiceMetrics(ServiceMetrics &&) = delete;
+    ServiceMetrics &operator=(const ServiceMetrics &) = delete;
+    ServiceMetrics &operator=(ServiceMetrics &&) = delete;
+
+private:
+    /**
+     * @brief Количество методов запроса.
+     */
+    static constexpr size_t methods_count{7};
+
+    /**
+     * @brief Количество классов кодов ответа: ошибка выполнения и 1xx-5xx.
+     */
+    static constexpr size_t statuses_count{6};
+
+    /**
+     * @brief Название сервиса.
+     */
+    std::string name_;
+
+    /**
+     * @brief Гистограммы по методам и классам кодов ответа.
+     */
+    std::array<std::array<Histogram, statuses_count>, methods_count>
+        histograms_;
+};
+
+/**
+ * @brief Общий для процесса реестр метрик сервисов.
+ */
+class MetricsRegistry final
+{
+public:
+    /**
+     * @brief Запрос единственного экземпляра.
+     *
+     * Объект не удаляется до завершения процесса, так как метрики обновляются
+     * из потока асинхронного выполнения запросов.
+     *
+     * @return Реестр метрик
+     */
+    static MetricsRegistry &Instance() noexcept;
+
+    /**
+     * @brief Запрос метрик сервиса. Функция потокобезопасна.
+     *
+     * @param name Название сервиса
+     *
+     * @return Метрики сервиса, существующие до завершения процесса
+     */
+    [[nodiscard]] ServiceMetrics *Get(std::string_view name) noexcept;
+
+    /**
+     * @brief Запрос текущих значений метрик всех сервисов.
+     *
+     * @return Метрики групп, в которых выполнялись запросы
+     */
+    [[nodiscard]] std::vector<Metrics::Series> Snapshot() const noexcept;
+
+    MetricsRegistry(const MetricsRegistry &) = delete;
+    MetricsRegistry(MetricsRegistry &&) = delete;
+    MetricsRegistry &operator=(const MetricsRegistry &) = delete;
+    MetricsRegistry &operator=(MetricsRegistry &&) = delete;
+
+private:
+    /**
+     * @brief Конструктор.
+     */
+    MetricsRegistry() noexcept;
+
+    /**
+     * @brief Деструктор.
+     */
+    ~MetricsRegistry() noexcept;
+
+    /**
+     * @brief Блокировка реестра.
+     */
+    mutable std::shared_mutex mutex_;
+
+    /**
+     * @brief Метрики сервисов по названиям.
+     */
+    std::unordered_map<std::string, std::unique_ptr<ServiceMetrics>> services_;
+};
+
+}  // namespace tasp::http
+
+#endif  // TASP_SERVICE_METRICS_HPP_
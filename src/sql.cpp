@@ -0,0 +1,23 @@
+#include "tasp/http/sql.hpp"
+
+#include "http/uri_impl.hpp"
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    SQLCondition
+------------------------------------------------------------------------------*/
+SQLCondition ToSQLCondition(const Uri &uri,
+                            SQLCondition::Placeholder placeholder) noexcept
+{
+    const auto *impl = dynamic_cast<const UriImpl *>(&uri);
+    if (impl == nullptr)
+    {
+        return {};
+    }
+
+    return impl->ToSQLCondition(placeholder);
+}
+
+}  // namespace tasp::http
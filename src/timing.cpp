@@ -0,0 +1,22 @@
+#include "tasp/http/timing.hpp"
+
+#include "http/response_impl.hpp"
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    Timing
+------------------------------------------------------------------------------*/
+Timing GetTiming(const Response &response) noexcept
+{
+    const auto *impl = dynamic_cast<const ResponseImpl *>(&response);
+    if (impl == nullptr)
+    {
+        return {};
+    }
+
+    return impl->GetTiming();
+}
+
+}  // namespace tasp::http
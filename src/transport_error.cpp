@@ -0,0 +1,99 @@
+#include "transport_error.hpp"
+
+#include "http/response_impl.hpp"
+
+namespace tasp::http
+{
+
+/*------------------------------------------------------------------------------
+    TransportError
+------------------------------------------------------------------------------*/
+TransportError MakeTransportError(CURLcode result) noexcept
+{
+    using Category = TransportError::Category;
+
+    TransportError error;
+    if (result == CURLE_OK)
+    {
+        return error;
+    }
+
+    error.code = static_cast<int>(result);
+    error.message = curl_easy_strerror(result);
+
+    auto set = [&error](Category category, bool retriable)
+    {
+        error.category = category;
+        error.retriable = retriable;
+    };
+
+    switch (result)
+    {
+        case CURLE_COULDNT_RESOLVE_HOST:
+        case CURLE_COULDNT_RESOLVE_PROXY:
+            set(Category::Resolve, true);
+            break;
+        case CURLE_COULDNT_CONNECT:
+            set(Category::Connect, true);
+            break;
+        case CURLE_OPERATION_TIMEDOUT:
+            set(Category::Timeout, true);
+            break;
+        case CURLE_SSL_CONNECT_ERROR:
+            set(Category::Tls, true);
+            break;
+        case CURLE_PEER_FAILED_VERIFICATION:
+        case CURLE_SSL_CERTPROBLEM:
+        case CURLE_SSL_CIPHER:
+        case CURLE_SSL_CACERT_BADFILE:
+        case CURLE_SSL_ISSUER_ERROR:
+        case CURLE_SSL_PINNEDPUBKEYNOTMATCH:
+        case CURLE_SSL_INVALIDCERTSTATUS:
+            set(Category::Tls, false);
+            break;
+        case CURLE_SEND_ERROR:
+            set(Category::Send, true);
+            break;
+        case CURLE_RECV_ERROR:
+        case CURLE_GOT_NOTHING:
+        case CURLE_PARTIAL_FILE:
+            set(Category::Receive, true);
+            break;
+        case CURLE_HTTP2:
+        case CURLE_HTTP2_STREAM:
+            set(Category::Protocol, true);
+            break;
+        case CURLE_WEIRD_SERVER_REPLY:
+        case CURLE_UNSUPPORTED_PROTOCOL:
+        case CURLE_BAD_CONTENT_ENCODING:
+        case CURLE_TOO_MANY_REDIRECTS:
+            set(Category::Protocol, false);
+            break;
+        case CURLE_FILESIZE_EXCEEDED:
+            set(Category::Limit, false);
+            break;
+        case CURLE_ABORTED_BY_CALLBACK:
+        case CURLE_WRITE_ERROR:
+        case CURLE_READ_ERROR:
+            set(Category::Aborted, false);
+            break;
+        default:
+            set(Category::Other, false);
+    }
+
+    return error;
+}
+
+//------------------------------------------------------------------------------
+TransportError GetError(const Response &response) noexcept
+{
+    const auto *impl = dynamic_cast<const ResponseImpl *>(&response);
+    if (impl == nullptr)
+    {
+        return {};
+    }
+
+    return MakeTransportError(impl->GetResult());
+}
+
+}  // namespace tasp::http
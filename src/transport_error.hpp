@@ -0,0 +1,26 @@
+/**
+ * @file
+ * @brief Классификация ошибок передачи библиотеки CURL.
+ */
+#ifndef TASP_TRANSPORT_ERROR_HPP_
+#define TASP_TRANSPORT_ERROR_HPP_
+
+#include <curl/curl.h>
+
+#include <tasp/http/error.hpp>
+
+namespace tasp::http
+{
+
+/**
+ * @brief Формирование ошибки передачи по результату выполнения запроса.
+ *
+ * @param result Результат выполнения запроса библиотекой CURL
+ *
+ * @return Ошибка передачи, пустая при успешном выполнении
+ */
+[[nodiscard]] TransportError MakeTransportError(CURLcode result) noexcept;
+
+}  // namespace tasp::http
+
+#endif  // TASP_TRANSPORT_ERROR_HPP_